@@ -0,0 +1,105 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "algokit/bloom.h"
+#include "algokit/hash.h"
+#include "algokit/key.h"
+
+/*
+ * Context: a caching layer keeps recently seen user IDs in a separate
+ * chaining table, and about 90% of lookups ask for users that are not
+ * cached. Every miss still hashes the key and walks a chain. We build a
+ * blocked Bloom filter over the cached items, put it in front of the table,
+ * and time the same lookups with and without it.
+ */
+
+#define CACHED (1 << 20)
+#define PROBES (1 << 22)
+
+static double elapsed_ms(clock_t start) {
+    return (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+int main(void) {
+    uint64_t *ids = (uint64_t *)malloc(CACHED * sizeof(*ids));
+    Item *items = (Item *)malloc(CACHED * sizeof(*items));
+    uint64_t *probes = (uint64_t *)malloc(PROBES * sizeof(*probes));
+    algokit_hash_sc *cache = algokit_hash_sc_create(CACHED, algokit_key_hash_u64, algokit_key_cmp_u64);
+    algokit_bloom *filter = NULL;
+    uint32_t seed = 2463534242u;
+    uint64_t late_id = 99;
+    size_t hits;
+    size_t skipped;
+    clock_t start;
+    Item item;
+    size_t i;
+
+    /* Fill the cache; IDs are multiples of 10, so probes can miss on purpose. */
+    if (ids && items && probes && cache) {
+        for (i = 0; i < CACHED; i++) {
+            ids[i] = (uint64_t)i * 10;
+            items[i].key = &ids[i];
+            items[i].val = &ids[i];
+            algokit_hash_sc_put(cache, items[i]);
+        }
+
+        /* Bulk-build the filter from the same Item array, targeting 1% false positives. */
+        filter = algokit_bloom_build(items, CACHED, algokit_key_hash_u64, 0.01);
+    }
+    if (!filter) {
+        free(ids);
+        free(items);
+        free(probes);
+        algokit_hash_sc_destroy(cache, NULL);
+        return 1;
+    }
+    printf("%d cached users, filter uses %lu KiB (%.1f bits per key)\n", CACHED,
+           (unsigned long)(algokit_bloom_bytes(filter) / 1024), algokit_bloom_bytes(filter) * 8.0 / CACHED);
+
+    /* Random user IDs to look up: only one in ten is a multiple of 10. */
+    for (i = 0; i < PROBES; i++) {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        probes[i] = seed % (10u * CACHED);
+    }
+
+    /* Time the lookups on the table alone. */
+    start = clock();
+    for (i = 0, hits = 0; i < PROBES; i++) {
+        hits += algokit_hash_sc_get(cache, &probes[i], &item) == 0;
+    }
+    printf("table only:     %.1f ms, %lu hits\n", elapsed_ms(start), (unsigned long)hits);
+
+    /* Same lookups through the filter: most misses never reach the table. */
+    start = clock();
+    for (i = 0, hits = 0; i < PROBES; i++) {
+        hits += algokit_bloom_hash_sc_get(filter, cache, algokit_key_hash_u64, &probes[i], &item) == 0;
+    }
+    printf("filter + table: %.1f ms, %lu hits\n", elapsed_ms(start), (unsigned long)hits);
+
+    /* Time the filter test alone and count the probes it rejects. */
+    start = clock();
+    for (i = 0, skipped = 0; i < PROBES; i++) {
+        skipped += !algokit_bloom_maybe_contains(filter, algokit_key_hash_u64(&probes[i]));
+    }
+    printf("filter alone:   %.1f ms, %.1f%% of probes rejected\n", elapsed_ms(start),
+           100.0 * (double)skipped / PROBES);
+
+    /* A user cached later goes through the filter too, so it stays visible. */
+    item.key = &late_id;
+    item.val = &late_id;
+    algokit_bloom_hash_sc_put(filter, cache, algokit_key_hash_u64, item);
+    printf("late user 99 %s\n",
+           algokit_bloom_hash_sc_get(filter, cache, algokit_key_hash_u64, &late_id, &item) == 0 ? "found" : "missing");
+
+    /* Keys live in the ids array, so the table owns nothing. */
+    algokit_bloom_destroy(filter);
+    algokit_hash_sc_destroy(cache, NULL);
+    free(ids);
+    free(items);
+    free(probes);
+    return 0;
+}
@@ -0,0 +1,134 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "algokit/bptree.h"
+#include "algokit/key.h"
+#include "algokit/rbtree.h"
+
+/*
+ * Context: an event store indexes events by timestamp. Events arrive out of
+ * order, individual events are looked up by timestamp, and reports sum the
+ * events of a time window. We build the same index as a B+tree and as a
+ * red-black tree and time each step.
+ */
+
+#define EVENTS (1 << 20)
+#define LOOKUPS (1 << 20)
+#define WINDOWS 2000
+#define WINDOW_SPAN 20000
+
+static double elapsed_ms(clock_t start) {
+    return (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+static uint32_t next_random(uint32_t *seed) {
+    *seed ^= *seed << 13;
+    *seed ^= *seed >> 17;
+    *seed ^= *seed << 5;
+    return *seed;
+}
+
+static void add_event(const Item *item, void *ctx) {
+    *(uint64_t *)ctx += *(const uint64_t *)item->val;
+}
+
+int main(void) {
+    uint64_t *stamps = (uint64_t *)malloc(EVENTS * sizeof(*stamps));
+    uint64_t *sizes = (uint64_t *)malloc(EVENTS * sizeof(*sizes));
+    uint64_t *queries = (uint64_t *)malloc(LOOKUPS * sizeof(*queries));
+    algokit_bptree *btree = algokit_bptree_create(algokit_key_cmp_u64);
+    algokit_rbtree *rbtree = algokit_rbtree_create(algokit_key_cmp_u64);
+    uint32_t seed = 2463534242u;
+    uint64_t total;
+    uint64_t lo;
+    uint64_t hi;
+    size_t found;
+    clock_t start;
+    Item item;
+    size_t i;
+
+    if (!stamps || !sizes || !queries || !btree || !rbtree) {
+        free(stamps);
+        free(sizes);
+        free(queries);
+        algokit_bptree_destroy(btree, NULL);
+        algokit_rbtree_destroy(rbtree, NULL);
+        return 1;
+    }
+
+    /* Distinct timestamps 0, 10, 20, ... arriving in a shuffled order. */
+    for (i = 0; i < EVENTS; i++) {
+        stamps[i] = (uint64_t)i * 10;
+    }
+    for (i = EVENTS - 1; i > 0; i--) {
+        size_t j = next_random(&seed) % (i + 1);
+        uint64_t tmp = stamps[i];
+        stamps[i] = stamps[j];
+        stamps[j] = tmp;
+    }
+    for (i = 0; i < LOOKUPS; i++) {
+        queries[i] = (uint64_t)(next_random(&seed) % EVENTS) * 10;
+    }
+
+    /* Build both indexes over the same keys and payloads (an event size each). */
+    for (i = 0; i < EVENTS; i++) {
+        sizes[i] = stamps[i] % 1000;
+    }
+    start = clock();
+    for (i = 0; i < EVENTS; i++) {
+        item.key = &stamps[i];
+        item.val = &sizes[i];
+        algokit_bptree_insert(btree, item);
+    }
+    printf("B+tree   insert: %7.1f ms\n", elapsed_ms(start));
+    start = clock();
+    for (i = 0; i < EVENTS; i++) {
+        item.key = &stamps[i];
+        item.val = &sizes[i];
+        algokit_rbtree_insert(rbtree, item);
+    }
+    printf("rb-tree  insert: %7.1f ms\n", elapsed_ms(start));
+
+    /* Point lookups by timestamp. */
+    start = clock();
+    for (i = 0, found = 0; i < LOOKUPS; i++) {
+        found += algokit_bptree_search(btree, &queries[i], &item) == 0;
+    }
+    printf("B+tree   search: %7.1f ms, %lu found\n", elapsed_ms(start), (unsigned long)found);
+    start = clock();
+    for (i = 0, found = 0; i < LOOKUPS; i++) {
+        found += algokit_rbtree_search(rbtree, &queries[i], &item) == 0;
+    }
+    printf("rb-tree  search: %7.1f ms, %lu found\n", elapsed_ms(start), (unsigned long)found);
+
+    /* Window reports: the B+tree finds the first event, then follows the leaf links. */
+    start = clock();
+    for (i = 0, total = 0; i < WINDOWS; i++) {
+        lo = queries[i];
+        hi = lo + WINDOW_SPAN;
+        algokit_bptree_range(btree, &lo, &hi, add_event, &total);
+    }
+    printf("B+tree   %d windows: %7.1f ms, total size %lu\n", WINDOWS, elapsed_ms(start), (unsigned long)total);
+
+    /* Drop the 100 oldest events from the B+tree index; remove hands each item back. */
+    for (i = 0, found = 0; i < 100; i++) {
+        uint64_t stamp = (uint64_t)i * 10;
+        found += algokit_bptree_remove(btree, &stamp, &item) == 0;
+    }
+    printf("removed %lu events, %lu left; ", (unsigned long)found, (unsigned long)algokit_bptree_size(btree));
+    lo = 0;
+    hi = 1990;
+    total = 0;
+    algokit_bptree_range(btree, &lo, &hi, add_event, &total);
+    printf("window [0, 1990] now sums to %lu\n", (unsigned long)total);
+
+    /* Keys and payloads live in arrays, so the trees own nothing. */
+    algokit_rbtree_destroy(rbtree, NULL);
+    algokit_bptree_destroy(btree, NULL);
+    free(stamps);
+    free(sizes);
+    free(queries);
+    return 0;
+}
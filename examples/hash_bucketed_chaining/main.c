@@ -0,0 +1,97 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "algokit/hash.h"
+
+/*
+ * Context: a large lookup table keyed by integer IDs, probed at random.
+ * In the classic chained table every node is a separate cache miss; the
+ * bucketed table keeps up to 3 items inline in one 64-byte block per bucket.
+ * We load the same keys into both tables, time the same lookups, and then
+ * delete part of the keys from the bucketed table.
+ */
+
+#define KEY_COUNT (1 << 20)
+#define PROBES (1 << 21)
+
+static size_t int_hash(const void *key) {
+    return (size_t)(*(const int *)key * 2654435761u);
+}
+
+static int int_cmp(const void *a, const void *b) {
+    int va = *(const int *)a;
+    int vb = *(const int *)b;
+    return (va > vb) - (va < vb);
+}
+
+static double elapsed_ms(clock_t start) {
+    return (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+int main(void) {
+    int *keys = (int *)malloc(KEY_COUNT * sizeof(*keys));
+    int *probes = (int *)malloc(PROBES * sizeof(*probes));
+    algokit_hash_sc *sc = algokit_hash_sc_create(8, int_hash, int_cmp);
+    algokit_hash_bc *bc = algokit_hash_bc_create(8, int_hash, int_cmp);
+    uint32_t seed = 2463534242u;
+    size_t found;
+    clock_t start;
+    Item item;
+    int i;
+
+    /* Create both tables and the key storage. */
+    if (!keys || !probes || !sc || !bc) {
+        free(keys);
+        free(probes);
+        algokit_hash_sc_destroy(sc, NULL);
+        algokit_hash_bc_destroy(bc, NULL);
+        return 1;
+    }
+
+    /* Load the same keys into both tables. */
+    for (i = 0; i < KEY_COUNT; i++) {
+        keys[i] = i;
+        item.key = &keys[i];
+        item.val = NULL;
+        algokit_hash_sc_put(sc, item);
+        algokit_hash_bc_put(bc, item);
+    }
+
+    /* Random probe keys; about half of them are outside the key range and miss. */
+    for (i = 0; i < PROBES; i++) {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        probes[i] = (int)(seed % (2u * KEY_COUNT));
+    }
+
+    /* Time the lookups on each table. */
+    start = clock();
+    for (i = 0, found = 0; i < PROBES; i++) {
+        found += algokit_hash_sc_get(sc, &probes[i], &item) == 0;
+    }
+    printf("separate chaining: %.1f ms (%lu found)\n", elapsed_ms(start), (unsigned long)found);
+    start = clock();
+    for (i = 0, found = 0; i < PROBES; i++) {
+        found += algokit_hash_bc_get(bc, &probes[i], &item) == 0;
+    }
+    printf("bucketed chaining: %.1f ms (%lu found)\n", elapsed_ms(start), (unsigned long)found);
+
+    /* Delete the even keys; blocks stay dense because the chain's last item fills each hole. */
+    for (i = 0; i < KEY_COUNT; i += 2) {
+        algokit_hash_bc_delete(bc, &keys[i], &item);
+    }
+    i = 2;
+    printf("after deletes: key %d %s, ", i, algokit_hash_bc_get(bc, &i, &item) == 0 ? "found" : "missing");
+    i = 3;
+    printf("key %d %s\n", i, algokit_hash_bc_get(bc, &i, &item) == 0 ? "found" : "missing");
+
+    /* Destroy both tables; keys live in one array owned by main. */
+    algokit_hash_sc_destroy(sc, NULL);
+    algokit_hash_bc_destroy(bc, NULL);
+    free(probes);
+    free(keys);
+    return 0;
+}
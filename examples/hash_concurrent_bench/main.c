@@ -0,0 +1,153 @@
+#define _POSIX_C_SOURCE 200112L
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "algokit/hash.h"
+#include "algokit/hash_cc.h"
+
+/*
+ * Context: a service shares one lookup table between worker threads. The
+ * simple approach wraps algokit_hash_lp in a single mutex; the sharded map
+ * gives each shard its own writer mutex and lets lookups run without any
+ * lock. Four threads run a mix of lookups and delete+reinsert updates, and
+ * we time both maps at several read/write ratios.
+ */
+
+#define THREADS 4
+#define KEY_COUNT 100000
+#define OPS_PER_THREAD 400000
+
+static int keys[KEY_COUNT];
+
+static size_t int_hash(const void *key) {
+    return (size_t)(*(const int *)key * 2654435761u);
+}
+
+static int int_cmp(const void *a, const void *b) {
+    int va = *(const int *)a;
+    int vb = *(const int *)b;
+    return (va > vb) - (va < vb);
+}
+
+/* The baseline: one table, one lock for every thread. */
+struct locked_lp {
+    pthread_mutex_t lock;
+    algokit_hash_lp *table;
+};
+
+struct worker {
+    struct locked_lp *locked;
+    algokit_hash_cc *sharded;
+    unsigned read_percent;
+    uint32_t seed;
+};
+
+static uint32_t next_random(uint32_t *state) {
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+static void *worker_run(void *arg) {
+    struct worker *w = (struct worker *)arg;
+    algokit_hash_cc_reader *reader = w->sharded ? algokit_hash_cc_reader_create(w->sharded) : NULL;
+    Item item;
+    int i;
+
+    for (i = 0; i < OPS_PER_THREAD; i++) {
+        uint32_t r = next_random(&w->seed);
+        int *key = &keys[r % KEY_COUNT];
+        int read = (r >> 20) % 100 < w->read_percent;
+
+        if (w->sharded) {
+            if (read) {
+                algokit_hash_cc_get(w->sharded, reader, key, &item);
+            } else if (algokit_hash_cc_delete(w->sharded, key, &item) == 0) {
+                algokit_hash_cc_put(w->sharded, item);
+            }
+        } else {
+            pthread_mutex_lock(&w->locked->lock);
+            if (read) {
+                algokit_hash_lp_get(w->locked->table, key, &item);
+            } else if (algokit_hash_lp_delete(w->locked->table, key, &item) == 0) {
+                algokit_hash_lp_put(w->locked->table, item);
+            }
+            pthread_mutex_unlock(&w->locked->lock);
+        }
+    }
+    algokit_hash_cc_reader_destroy(w->sharded, reader);
+    return NULL;
+}
+
+/* Run all threads against one map and return the wall-clock time in milliseconds. */
+static double run(struct locked_lp *locked, algokit_hash_cc *sharded, unsigned read_percent) {
+    pthread_t threads[THREADS];
+    struct worker workers[THREADS];
+    struct timespec start;
+    struct timespec end;
+    int t;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (t = 0; t < THREADS; t++) {
+        workers[t].locked = locked;
+        workers[t].sharded = sharded;
+        workers[t].read_percent = read_percent;
+        workers[t].seed = 2463534242u + (uint32_t)t * 7919u;
+        pthread_create(&threads[t], NULL, worker_run, &workers[t]);
+    }
+    for (t = 0; t < THREADS; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    return (double)(end.tv_sec - start.tv_sec) * 1000.0 + (double)(end.tv_nsec - start.tv_nsec) / 1e6;
+}
+
+int main(void) {
+    static const unsigned ratios[] = {50, 90, 99};
+    struct locked_lp locked;
+    algokit_hash_cc *sharded = algokit_hash_cc_create(64, KEY_COUNT, int_hash, int_cmp, NULL);
+    Item item;
+    size_t r;
+    int i;
+
+    /* Build both maps with the same keys. */
+    locked.table = algokit_hash_lp_create(KEY_COUNT, int_hash, int_cmp);
+    if (!sharded || !locked.table || pthread_mutex_init(&locked.lock, NULL) != 0) {
+        algokit_hash_cc_destroy(sharded, NULL);
+        algokit_hash_lp_destroy(locked.table, NULL);
+        return 1;
+    }
+    for (i = 0; i < KEY_COUNT; i++) {
+        keys[i] = i;
+        item.key = &keys[i];
+        item.val = NULL;
+        algokit_hash_lp_put(locked.table, item);
+        algokit_hash_cc_put(sharded, item);
+    }
+
+    /* Time each read/write mix on both maps. */
+    printf("%d threads, %d ops each, %lu shards\n", THREADS, OPS_PER_THREAD,
+           (unsigned long)algokit_hash_cc_shard_count(sharded));
+    for (r = 0; r < sizeof(ratios) / sizeof(ratios[0]); r++) {
+        double global_ms = run(&locked, NULL, ratios[r]);
+        double sharded_ms = run(NULL, sharded, ratios[r]);
+        printf("reads %u%%: global lock %.1f ms, sharded %.1f ms\n", ratios[r], global_ms, sharded_ms);
+    }
+
+    /* Every key is back in place after the delete+reinsert updates. */
+    printf("sharded size: %lu\n", (unsigned long)algokit_hash_cc_size(sharded));
+
+    /* Destroy both maps; keys live in a static array, so no retire callback was needed. */
+    pthread_mutex_destroy(&locked.lock);
+    algokit_hash_lp_destroy(locked.table, NULL);
+    algokit_hash_cc_destroy(sharded, NULL);
+    return 0;
+}
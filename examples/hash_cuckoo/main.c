@@ -0,0 +1,113 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "algokit/hash.h"
+
+/*
+ * Context: a request router keeps about a million live session IDs and must
+ * answer "is this session known?" within a fixed latency budget, mostly for
+ * IDs that are not in the table. A linear probing miss walks until it meets
+ * an empty slot, so its cost depends on how clustered the table is; a cuckoo
+ * miss always checks exactly two buckets (plus the stash, usually empty).
+ * We time misses in batches and report the average and the slowest batch.
+ */
+
+#define KEY_COUNT 900000
+#define PROBES (1 << 21)
+#define BATCH 1024
+
+static size_t int_hash(const void *key) {
+    return (size_t)(*(const int *)key * 2654435761u);
+}
+
+static int int_cmp(const void *a, const void *b) {
+    int va = *(const int *)a;
+    int vb = *(const int *)b;
+    return (va > vb) - (va < vb);
+}
+
+static double now_us(void) {
+    return (double)clock() * 1000000.0 / CLOCKS_PER_SEC;
+}
+
+int main(void) {
+    int *keys = (int *)malloc(KEY_COUNT * sizeof(*keys));
+    int *probes = (int *)malloc(PROBES * sizeof(*probes));
+    algokit_hash_lp *lp = algokit_hash_lp_create(KEY_COUNT, int_hash, int_cmp);
+    algokit_hash_ck *ck = algokit_hash_ck_create(KEY_COUNT, int_hash, int_cmp);
+    uint32_t seed = 2463534242u;
+    double lp_total = 0.0;
+    double ck_total = 0.0;
+    double lp_worst = 0.0;
+    double ck_worst = 0.0;
+    Item item;
+    int i;
+
+    /* Create both tables, sized for the expected number of sessions. */
+    if (!keys || !probes || !lp || !ck) {
+        free(keys);
+        free(probes);
+        algokit_hash_lp_destroy(lp, NULL);
+        algokit_hash_ck_destroy(ck, NULL);
+        return 1;
+    }
+
+    /* Load the same session IDs into both tables. */
+    for (i = 0; i < KEY_COUNT; i++) {
+        keys[i] = i * 2;
+        item.key = &keys[i];
+        item.val = NULL;
+        algokit_hash_lp_put(lp, item);
+        algokit_hash_ck_put(ck, item);
+    }
+
+    /* Unknown session IDs: odd numbers never appear in the tables. */
+    for (i = 0; i < PROBES; i++) {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        probes[i] = (int)(seed % (2u * KEY_COUNT)) | 1;
+    }
+
+    /* Time the misses batch by batch on each table. */
+    for (i = 0; i < PROBES; i += BATCH) {
+        double start = now_us();
+        double spent;
+        int j;
+
+        for (j = i; j < i + BATCH; j++) {
+            algokit_hash_lp_get(lp, &probes[j], &item);
+        }
+        spent = now_us() - start;
+        lp_total += spent;
+        lp_worst = spent > lp_worst ? spent : lp_worst;
+
+        start = now_us();
+        for (j = i; j < i + BATCH; j++) {
+            algokit_hash_ck_get(ck, &probes[j], &item);
+        }
+        spent = now_us() - start;
+        ck_total += spent;
+        ck_worst = spent > ck_worst ? spent : ck_worst;
+    }
+    printf("linear probing: %.0f ns per miss, slowest batch %.0f us\n", lp_total * 1000.0 / PROBES, lp_worst);
+    printf("cuckoo:         %.0f ns per miss, slowest batch %.0f us\n", ck_total * 1000.0 / PROBES, ck_worst);
+
+    /* Expire every other session; the cuckoo table keeps working without tombstones. */
+    for (i = 0; i < KEY_COUNT; i += 2) {
+        algokit_hash_ck_delete(ck, &keys[i], &item);
+    }
+    i = 0;
+    printf("after expiry: session %d %s, ", keys[i], algokit_hash_ck_get(ck, &keys[i], &item) == 0 ? "found" : "missing");
+    i = 1;
+    printf("session %d %s\n", keys[i], algokit_hash_ck_get(ck, &keys[i], &item) == 0 ? "found" : "missing");
+
+    /* Destroy both tables; keys live in one array owned by main. */
+    algokit_hash_lp_destroy(lp, NULL);
+    algokit_hash_ck_destroy(ck, NULL);
+    free(probes);
+    free(keys);
+    return 0;
+}
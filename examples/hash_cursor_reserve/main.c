@@ -0,0 +1,89 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "algokit/hash.h"
+
+/*
+ * Context: a nightly job bulk-loads account balances, reports the accounts
+ * in overdraft, purges the closed ones, and keeps the table for the next
+ * run. reserve sizes the table once before the load, cursors walk it
+ * without a shadow key list, shrink_to_fit gives memory back after the
+ * purge, and clear empties it for the next night.
+ */
+
+#define ACCOUNT_COUNT 10000
+
+struct account {
+    int id;
+    int balance;
+    int closed;
+};
+
+static size_t int_hash(const void *key) {
+    return (size_t)(*(const int *)key * 2654435761u);
+}
+
+static int int_cmp(const void *a, const void *b) {
+    int va = *(const int *)a;
+    int vb = *(const int *)b;
+    return (va > vb) - (va < vb);
+}
+
+int main(void) {
+    static struct account accounts[ACCOUNT_COUNT];
+    algokit_hash_lp *table = algokit_hash_lp_create(8, int_hash, int_cmp);
+    algokit_hash_cursor cursor;
+    Item item;
+    size_t overdrawn = 0;
+    size_t capacity;
+    int rc;
+    int i;
+
+    /* Create the table and reserve room for the whole load. */
+    if (!table || algokit_hash_lp_reserve(table, ACCOUNT_COUNT) != 0) {
+        algokit_hash_lp_destroy(table, NULL);
+        return 1;
+    }
+    capacity = algokit_hash_lp_capacity(table);
+
+    /* Bulk load: the table never resizes during this loop. */
+    for (i = 0; i < ACCOUNT_COUNT; i++) {
+        accounts[i].id = 5000 + i;
+        accounts[i].balance = (i * 37) % 1000 - 100;
+        accounts[i].closed = i % 4 != 0;
+        item.key = &accounts[i].id;
+        item.val = &accounts[i];
+        algokit_hash_lp_put(table, item);
+    }
+    printf("loaded %lu accounts, capacity %lu (reserved %lu)\n", (unsigned long)algokit_hash_lp_size(table),
+           (unsigned long)algokit_hash_lp_capacity(table), (unsigned long)capacity);
+
+    /* Walk every entry with a cursor. */
+    for (rc = algokit_hash_lp_first(table, &cursor, &item); rc == 0; rc = algokit_hash_lp_next(table, &cursor, &item)) {
+        if (((struct account *)item.val)->balance < 0) {
+            overdrawn++;
+        }
+    }
+    printf("accounts in overdraft: %lu\n", (unsigned long)overdrawn);
+
+    /* Purge closed accounts; deleting invalidates cursors, so delete from the source list. */
+    for (i = 0; i < ACCOUNT_COUNT; i++) {
+        if (accounts[i].closed) {
+            algokit_hash_lp_delete(table, &accounts[i].id, &item);
+        }
+    }
+
+    /* Give memory back after the purge. */
+    algokit_hash_lp_shrink_to_fit(table);
+    printf("after purge: %lu accounts, capacity %lu\n", (unsigned long)algokit_hash_lp_size(table),
+           (unsigned long)algokit_hash_lp_capacity(table));
+
+    /* Empty the table for the next run; the allocation is kept. */
+    algokit_hash_lp_clear(table, NULL);
+    printf("after clear: %lu accounts, capacity %lu\n", (unsigned long)algokit_hash_lp_size(table),
+           (unsigned long)algokit_hash_lp_capacity(table));
+
+    /* Destroy the table; accounts live in a static array. */
+    algokit_hash_lp_destroy(table, NULL);
+    return 0;
+}
@@ -0,0 +1,142 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "algokit/hash_frozen.h"
+#include "algokit/key.h"
+
+/*
+ * Context: a service loads 1 million country-routing rules keyed by 64-bit
+ * prefix IDs once at startup and then only reads them. We build the rules
+ * in a linear probing table, freeze it into a minimal perfect hash table,
+ * and compare slot counts and lookup times. Then we save the frozen index
+ * plus the rules in slot order to a file, load the file back as one buffer
+ * (a real service would mmap it), and answer queries from that buffer.
+ */
+
+#define RULES (1 << 20)
+#define PROBES (1 << 21)
+
+struct rule {
+    uint64_t prefix;
+    uint32_t route;
+};
+
+static double elapsed_ms(clock_t start) {
+    return (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+int main(void) {
+    struct rule *rules = (struct rule *)malloc(RULES * sizeof(*rules));
+    uint64_t *probes = (uint64_t *)malloc(PROBES * sizeof(*probes));
+    algokit_hash_lp *table = algokit_hash_lp_create(RULES, algokit_key_hash_u64, algokit_key_cmp_u64);
+    algokit_hash_frozen *frozen = NULL;
+    unsigned char *file_image = NULL;
+    uint32_t seed = 2463534242u;
+    size_t image_size;
+    size_t found;
+    clock_t start;
+    FILE *fp;
+    Item item;
+    size_t i;
+
+    /* Create the rules and load them into a linear probing table. */
+    if (!rules || !probes || !table) {
+        free(rules);
+        free(probes);
+        algokit_hash_lp_destroy(table, NULL);
+        return 1;
+    }
+    for (i = 0; i < RULES; i++) {
+        rules[i].prefix = UINT64_C(0x4400000000) + i * 977;
+        rules[i].route = (uint32_t)(i % 250);
+        item.key = &rules[i].prefix;
+        item.val = &rules[i];
+        algokit_hash_lp_put(table, item);
+    }
+
+    /* Freeze: the frozen table gets its own copy of the Items. */
+    start = clock();
+    frozen = algokit_hash_freeze(table, algokit_key_hash_u64, algokit_key_cmp_u64);
+    if (!frozen) {
+        free(rules);
+        free(probes);
+        algokit_hash_lp_destroy(table, NULL);
+        return 1;
+    }
+    image_size = algokit_hash_frozen_image_size(frozen);
+    printf("froze %lu rules in %.1f ms, index %lu bytes (%.1f bits per key)\n",
+           (unsigned long)algokit_hash_frozen_size(frozen), elapsed_ms(start), (unsigned long)image_size,
+           image_size * 8.0 / RULES);
+    printf("slots: linear probing %lu, frozen %lu\n", (unsigned long)algokit_hash_lp_capacity(table),
+           (unsigned long)algokit_hash_frozen_size(frozen));
+
+    /* Existing prefixes only: every probe is a hit. */
+    for (i = 0; i < PROBES; i++) {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        probes[i] = rules[seed % RULES].prefix;
+    }
+
+    /* Time the same lookups on both tables. */
+    start = clock();
+    for (i = 0, found = 0; i < PROBES; i++) {
+        found += algokit_hash_lp_get(table, &probes[i], &item) == 0;
+    }
+    printf("linear probing: %.1f ms (%lu found)\n", elapsed_ms(start), (unsigned long)found);
+    start = clock();
+    for (i = 0, found = 0; i < PROBES; i++) {
+        found += algokit_hash_frozen_get(frozen, &probes[i], &item) == 0;
+    }
+    printf("frozen:         %.1f ms (%lu found)\n", elapsed_ms(start), (unsigned long)found);
+
+    /* Save the index image followed by the rules in slot order. */
+    file_image = (unsigned char *)malloc(image_size + RULES * sizeof(struct rule));
+    if (file_image && algokit_hash_frozen_write_image(frozen, file_image, image_size) == 0) {
+        struct rule *slots = (struct rule *)(file_image + image_size);
+        for (i = 0; i < RULES; i++) {
+            algokit_hash_frozen_item_at(frozen, i, &item);
+            slots[i] = *(struct rule *)item.val;
+        }
+        fp = fopen("routes.bin", "wb");
+        if (fp) {
+            fwrite(file_image, 1, image_size + RULES * sizeof(struct rule), fp);
+            fclose(fp);
+        }
+    }
+    free(file_image);
+
+    /* Load the file as one buffer and query it without rebuilding anything. */
+    file_image = (unsigned char *)malloc(image_size + RULES * sizeof(struct rule));
+    fp = fopen("routes.bin", "rb");
+    if (file_image && fp && fread(file_image, 1, image_size + RULES * sizeof(struct rule), fp) > 0) {
+        const struct rule *slots = (const struct rule *)(file_image + image_size);
+        uint64_t prefix = rules[12345].prefix;
+        uint64_t unknown = prefix + 1;
+        size_t index;
+
+        if (algokit_hash_frozen_image_index(file_image, image_size, algokit_key_hash_u64(&prefix), &index) == 0 &&
+            slots[index].prefix == prefix) {
+            printf("prefix %llx routes to %u\n", (unsigned long long)prefix, slots[index].route);
+        }
+        /* An unknown prefix still maps to some slot; the stored prefix tells it apart. */
+        if (algokit_hash_frozen_image_index(file_image, image_size, algokit_key_hash_u64(&unknown), &index) == 0 &&
+            slots[index].prefix != unknown) {
+            printf("prefix %llx has no route\n", (unsigned long long)unknown);
+        }
+    }
+    if (fp) {
+        fclose(fp);
+    }
+    remove("routes.bin");
+
+    /* Destroy everything; the rule array is owned by main. */
+    free(file_image);
+    algokit_hash_frozen_destroy(frozen, NULL);
+    algokit_hash_lp_destroy(table, NULL);
+    free(probes);
+    free(rules);
+    return 0;
+}
@@ -0,0 +1,126 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "algokit/hash_region.h"
+
+/*
+ * Context: several worker processes on one host need the same product price
+ * table. Instead of every worker building its own copy, one process builds
+ * the table once inside a memory-mapped file, seals it, and the workers map
+ * the file read-only and query it in place. The mapping address may differ
+ * from process to process; the table does not care because it only stores
+ * offsets. (POSIX only: mmap, fork.)
+ */
+
+#define PRODUCTS 10000
+#define WORKERS 3
+#define REGION_FILE "prices.region"
+
+struct price {
+    uint32_t cents;
+    uint32_t stock;
+};
+
+/* A worker maps the sealed file read-only and answers a few queries. */
+static int run_worker(int worker, size_t size) {
+    int fd = open(REGION_FILE, O_RDONLY);
+    const algokit_hash_region *prices;
+    const void *val;
+    size_t val_len;
+    char sku[32];
+    void *base;
+    int i;
+
+    if (fd < 0) {
+        return 1;
+    }
+    base = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        return 1;
+    }
+
+    prices = algokit_hash_region_open(base, size);
+    if (!prices) {
+        munmap(base, size);
+        return 1;
+    }
+    for (i = 0; i < 2; i++) {
+        sprintf(sku, "SKU-%05d", worker * 1000 + i * 7);
+        if (algokit_hash_region_get(prices, sku, strlen(sku), &val, &val_len) == 0) {
+            const struct price *p = (const struct price *)val;
+            printf("worker %d: %s costs %u.%02u, %u in stock\n", worker, sku,
+                   (unsigned)(p->cents / 100), (unsigned)(p->cents % 100), (unsigned)p->stock);
+        }
+    }
+
+    munmap(base, size);
+    fflush(stdout);
+    return 0;
+}
+
+int main(void) {
+    size_t size = algokit_hash_region_bytes(PRODUCTS, PRODUCTS * 24);
+    algokit_hash_region *prices;
+    struct price p;
+    char sku[32];
+    void *base;
+    int status;
+    int fd;
+    int i;
+
+    /* Create the backing file and map it writable for the builder. */
+    fd = open(REGION_FILE, O_RDWR | O_CREAT | O_TRUNC, 0600);
+    if (fd < 0) {
+        return 1;
+    }
+    if (ftruncate(fd, (off_t)size) != 0) {
+        close(fd);
+        return 1;
+    }
+    base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        return 1;
+    }
+
+    /* Build the table once: keys are SKU strings, values are small structs copied into the region. */
+    prices = algokit_hash_region_init(base, size, PRODUCTS);
+    for (i = 0; prices && i < PRODUCTS; i++) {
+        sprintf(sku, "SKU-%05d", i);
+        p.cents = (uint32_t)(199 + (i * 37) % 9800);
+        p.stock = (uint32_t)(i % 120);
+        algokit_hash_region_put(prices, sku, strlen(sku), &p, sizeof(p));
+    }
+    if (!prices || algokit_hash_region_seal(prices) != 0 || msync(base, size, MS_SYNC) != 0) {
+        munmap(base, size);
+        remove(REGION_FILE);
+        return 1;
+    }
+    printf("built %lu prices in a %lu-byte region\n", (unsigned long)algokit_hash_region_count(prices),
+           (unsigned long)size);
+    munmap(base, size);
+
+    /* Start the workers one after another; each maps the file on its own. */
+    fflush(stdout);
+    for (i = 0; i < WORKERS; i++) {
+        pid_t pid = fork();
+        if (pid == 0) {
+            _exit(run_worker(i, size));
+        }
+        if (pid > 0) {
+            waitpid(pid, &status, 0);
+        }
+    }
+
+    /* The table is a plain file; remove it when done. */
+    remove(REGION_FILE);
+    return 0;
+}
@@ -0,0 +1,85 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "algokit/hash.h"
+
+/*
+ * Context: a session cache keyed by integer session IDs. Sessions open and
+ * close all day, so the table sees as many deletes as inserts. The Robin Hood
+ * table shifts entries back on delete instead of leaving tombstones, so
+ * lookups stay short no matter how long the churn runs.
+ */
+
+#define SESSION_COUNT 1000
+#define ROUNDS 50
+
+static size_t int_hash(const void *key) {
+    return (size_t)(*(const int *)key * 2654435761u);
+}
+
+static int int_cmp(const void *a, const void *b) {
+    int va = *(const int *)a;
+    int vb = *(const int *)b;
+    return (va > vb) - (va < vb);
+}
+
+int main(void) {
+    static int ids[SESSION_COUNT];
+    static int users[SESSION_COUNT];
+    algokit_hash_rh *table = algokit_hash_rh_create(64, int_hash, int_cmp);
+    Item item;
+    size_t live = 0;
+    int round;
+    int i;
+
+    /* Create the table; the capacity is rounded up to a power of two. */
+    if (!table) {
+        return 1;
+    }
+
+    /* Open every session once. */
+    for (i = 0; i < SESSION_COUNT; i++) {
+        ids[i] = 100000 + i;
+        users[i] = i % 37;
+        item.key = &ids[i];
+        item.val = &users[i];
+        if (algokit_hash_rh_put(table, item) != 0) {
+            algokit_hash_rh_destroy(table, NULL);
+            return 1;
+        }
+    }
+
+    /* Churn: each round closes half of the sessions and reopens them. */
+    for (round = 0; round < ROUNDS; round++) {
+        for (i = round % 2; i < SESSION_COUNT; i += 2) {
+            algokit_hash_rh_delete(table, &ids[i], &item);
+        }
+        for (i = round % 2; i < SESSION_COUNT; i += 2) {
+            item.key = &ids[i];
+            item.val = &users[i];
+            algokit_hash_rh_put(table, item);
+        }
+    }
+
+    /* Every session is still reachable after the churn. */
+    for (i = 0; i < SESSION_COUNT; i++) {
+        if (algokit_hash_rh_get(table, &ids[i], &item) == 0) {
+            live++;
+        }
+    }
+    printf("live sessions after %d rounds: %lu\n", ROUNDS, (unsigned long)live);
+
+    /* Look up one session and a missing one. */
+    i = 100042;
+    if (algokit_hash_rh_get(table, &i, &item) == 0) {
+        printf("get: session %d -> user %d\n", *(int *)item.key, *(int *)item.val);
+    }
+    i = 42;
+    if (algokit_hash_rh_get(table, &i, &item) == 1) {
+        printf("get: session %d not found\n", i);
+    }
+
+    /* Destroy the table; keys and values live in static arrays. */
+    algokit_hash_rh_destroy(table, NULL);
+    return 0;
+}
@@ -0,0 +1,115 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "algokit/hash.h"
+#include "algokit/key.h"
+
+/*
+ * Context: a session store keyed by 64-bit session IDs is slow in
+ * production, and we want to know why before touching the code. We print
+ * the table statistics after a bulk load, after heavy login/logout churn
+ * (tombstones), and after shrink_to_fit, then load the same sessions into a
+ * table whose hash only looks at the low byte of the ID.
+ */
+
+#define SESSIONS 100000
+
+/* A regression: the hash only keeps 8 bits, so at most 256 distinct values exist. */
+static size_t low_byte_hash(const void *key) {
+    return (size_t)(*(const uint64_t *)key & 0xFF);
+}
+
+static void report(const char *label, const algokit_hash_stats *stats) {
+    size_t i;
+
+    printf("%s\n", label);
+    printf("  size %lu, capacity %lu, load %.2f, tombstones %lu\n", (unsigned long)stats->size,
+           (unsigned long)stats->capacity, stats->load_factor, (unsigned long)stats->tombstones);
+    printf("  probe avg %.2f, max %lu, grows %lu, shrinks %lu\n", stats->avg_probe,
+           (unsigned long)stats->max_probe, (unsigned long)stats->grow_count, (unsigned long)stats->shrink_count);
+    printf("  probe histogram:");
+    for (i = 0; i < ALGOKIT_HASH_STATS_HISTOGRAM; i++) {
+        printf(" %lu", (unsigned long)stats->probe_histogram[i]);
+    }
+    printf("\n");
+}
+
+/* The alert rules a monitoring job could apply to every sample. */
+static void diagnose(const algokit_hash_stats *stats) {
+    if (stats->max_probe > 64 || stats->avg_probe > 4.0) {
+        printf("  -> long probes at load %.2f: suspect the hash function\n", stats->load_factor);
+    } else if (stats->tombstones > stats->size / 2) {
+        printf("  -> tombstones pile up: call shrink_to_fit\n");
+    } else {
+        printf("  -> healthy\n");
+    }
+}
+
+int main(void) {
+    uint64_t *ids = (uint64_t *)malloc(SESSIONS * sizeof(*ids));
+    algokit_hash_lp *sessions = algokit_hash_lp_create(8, algokit_key_hash_u64, algokit_key_cmp_u64);
+    algokit_hash_lp *regressed = algokit_hash_lp_create(8, low_byte_hash, algokit_key_cmp_u64);
+    algokit_hash_stats stats;
+    uint64_t id;
+    Item item;
+    size_t round;
+    size_t i;
+
+    if (!ids || !sessions || !regressed) {
+        free(ids);
+        algokit_hash_lp_destroy(sessions, NULL);
+        algokit_hash_lp_destroy(regressed, NULL);
+        return 1;
+    }
+
+    /* Bulk-load the sessions and take a first sample. */
+    for (i = 0; i < SESSIONS; i++) {
+        ids[i] = UINT64_C(0x5E55000000000000) + (uint64_t)i * 7919;
+        item.key = &ids[i];
+        item.val = NULL;
+        algokit_hash_lp_put(sessions, item);
+    }
+    algokit_hash_lp_stats(sessions, &stats);
+    report("after load", &stats);
+    diagnose(&stats);
+
+    /* Churn: log out a quarter of the sessions and log them back in with new IDs, several times. */
+    for (round = 1; round <= 6; round++) {
+        for (i = round % 4; i < SESSIONS; i += 4) {
+            algokit_hash_lp_delete(sessions, &ids[i], &item);
+            ids[i] += UINT64_C(1) << 40;
+            item.key = &ids[i];
+            algokit_hash_lp_put(sessions, item);
+        }
+    }
+    algokit_hash_lp_stats(sessions, &stats);
+    report("after churn", &stats);
+    diagnose(&stats);
+
+    /* Rebuilding drops every tombstone. */
+    algokit_hash_lp_shrink_to_fit(sessions);
+    algokit_hash_lp_stats(sessions, &stats);
+    report("after shrink_to_fit", &stats);
+    diagnose(&stats);
+
+    /* Same sessions, weak hash: the load factor looks normal, the probe lengths do not. */
+    for (i = 0; i < SESSIONS; i += 10) {
+        item.key = &ids[i];
+        algokit_hash_lp_put(regressed, item);
+    }
+    algokit_hash_lp_stats(regressed, &stats);
+    report("low-byte hash", &stats);
+    diagnose(&stats);
+
+    /* A missing ID must walk the whole cluster of its hash value. */
+    id = 12345;
+    printf("lookup of unknown id %llu: %s\n", (unsigned long long)id,
+           algokit_hash_lp_get(regressed, &id, &item) == 0 ? "found" : "missing");
+
+    /* Keys live in the ids array, so neither table owns anything. */
+    algokit_hash_lp_destroy(sessions, NULL);
+    algokit_hash_lp_destroy(regressed, NULL);
+    free(ids);
+    return 0;
+}
@@ -0,0 +1,97 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "algokit/hash.h"
+
+/*
+ * Context: a word-frequency dictionary keyed by strings, stored in the
+ * SwissTable-style table. Control bytes let most probes reject a slot
+ * without calling strcmp. We insert words, update counts, look up present
+ * and missing words, delete one, and free everything at the end.
+ */
+
+static size_t str_hash(const void *key) {
+    const unsigned char *s = (const unsigned char *)key;
+    size_t h = 5381;
+    while (*s) {
+        h = h * 33 + *s++;
+    }
+    return h;
+}
+
+static int str_cmp(const void *a, const void *b) {
+    return strcmp((const char *)a, (const char *)b);
+}
+
+static void destroy_kv(void *key, void *val) {
+    free(key);
+    free(val);
+}
+
+/* Insert a word with count 1, or bump the count when the word exists. */
+static int count_word(algokit_hash_sw *table, const char *word) {
+    Item item;
+    char *key;
+    int *count;
+
+    if (algokit_hash_sw_get(table, word, &item) == 0) {
+        (*(int *)item.val)++;
+        return 0;
+    }
+
+    key = (char *)malloc(strlen(word) + 1);
+    count = (int *)malloc(sizeof(*count));
+    if (!key || !count) {
+        free(key);
+        free(count);
+        return -1;
+    }
+    strcpy(key, word);
+    *count = 1;
+    item.key = key;
+    item.val = count;
+    if (algokit_hash_sw_put(table, item) != 0) {
+        destroy_kv(key, count);
+        return -1;
+    }
+    return 0;
+}
+
+int main(void) {
+    const char *text[] = {"the", "quick", "brown", "fox", "jumps", "over", "the", "lazy", "dog", "the", "fox"};
+    algokit_hash_sw *table = algokit_hash_sw_create(16, str_hash, str_cmp);
+    Item item;
+    size_t i;
+
+    /* Create the table; the capacity is rounded up to a multiple of 16 slots. */
+    if (!table) {
+        return 1;
+    }
+
+    /* Count every word of the text. */
+    for (i = 0; i < sizeof(text) / sizeof(text[0]); i++) {
+        if (count_word(table, text[i]) != 0) {
+            algokit_hash_sw_destroy(table, destroy_kv);
+            return 1;
+        }
+    }
+
+    /* Look up a present word and a missing one. */
+    if (algokit_hash_sw_get(table, "the", &item) == 0) {
+        printf("get: %s -> %d\n", (char *)item.key, *(int *)item.val);
+    }
+    if (algokit_hash_sw_get(table, "cat", &item) == 1) {
+        printf("get: cat not found\n");
+    }
+
+    /* Delete a word; the table hands the item back so we can free it. */
+    if (algokit_hash_sw_delete(table, "fox", &item) == 0) {
+        printf("delete: %s -> %d\n", (char *)item.key, *(int *)item.val);
+        destroy_kv(item.key, item.val);
+    }
+
+    /* Destroy table; remaining items freed by callback. */
+    algokit_hash_sw_destroy(table, destroy_kv);
+    return 0;
+}
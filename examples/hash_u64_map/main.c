@@ -0,0 +1,104 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "algokit/hash.h"
+#include "algokit/hash_u64.h"
+#include "algokit/key.h"
+
+/*
+ * Context: an order book maps 64-bit order IDs to a price level index.
+ * With the generic table every key and value is a separately allocated
+ * uint64_t behind an Item, and each probe calls the hash and cmp callbacks.
+ * algokit_hash_u64 stores both numbers inline in its slots. We load the same
+ * orders into both maps, time random lookups, and cancel some orders.
+ */
+
+#define ORDERS (1 << 20)
+#define PROBES (1 << 21)
+
+static double elapsed_ms(clock_t start) {
+    return (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+static void free_kv(void *key, void *val) {
+    free(key);
+    free(val);
+}
+
+int main(void) {
+    uint64_t *probes = (uint64_t *)malloc(PROBES * sizeof(*probes));
+    algokit_hash_lp *generic = algokit_hash_lp_create(ORDERS, algokit_key_hash_u64, algokit_key_cmp_u64);
+    algokit_hash_u64 *orders = algokit_hash_u64_create(ORDERS);
+    uint32_t seed = 2463534242u;
+    uint64_t level;
+    uint64_t sum;
+    clock_t start;
+    Item item;
+    size_t i;
+
+    /* Create both maps, sized for the expected number of orders. */
+    if (!probes || !generic || !orders) {
+        free(probes);
+        algokit_hash_lp_destroy(generic, NULL);
+        algokit_hash_u64_destroy(orders);
+        return 1;
+    }
+
+    /* Load the same orders; the generic table needs two allocations per order. */
+    for (i = 0; i < ORDERS; i++) {
+        uint64_t id = UINT64_C(7000000000) + i * 3;
+        uint64_t *key = (uint64_t *)malloc(sizeof(*key));
+        uint64_t *val = (uint64_t *)malloc(sizeof(*val));
+        if (!key || !val) {
+            free(key);
+            free(val);
+            break;
+        }
+        *key = id;
+        *val = i % 500;
+        item.key = key;
+        item.val = val;
+        algokit_hash_lp_put(generic, item);
+        algokit_hash_u64_put(orders, id, i % 500);
+    }
+    printf("%lu orders loaded\n", (unsigned long)algokit_hash_u64_size(orders));
+
+    /* Random order IDs to look up; two out of three do not exist. */
+    for (i = 0; i < PROBES; i++) {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        probes[i] = UINT64_C(7000000000) + seed % (3u * ORDERS);
+    }
+
+    /* Time the same lookups on both maps. */
+    start = clock();
+    for (i = 0, sum = 0; i < PROBES; i++) {
+        if (algokit_hash_lp_get(generic, &probes[i], &item) == 0) {
+            sum += *(uint64_t *)item.val;
+        }
+    }
+    printf("generic table: %.1f ms (checksum %llu)\n", elapsed_ms(start), (unsigned long long)sum);
+    start = clock();
+    for (i = 0, sum = 0; i < PROBES; i++) {
+        if (algokit_hash_u64_get(orders, probes[i], &level) == 0) {
+            sum += level;
+        }
+    }
+    printf("hash_u64 map:  %.1f ms (checksum %llu)\n", elapsed_ms(start), (unsigned long long)sum);
+
+    /* Cancel every other order; deletes leave no tombstones behind. */
+    for (i = 0; i < ORDERS; i += 2) {
+        algokit_hash_u64_delete(orders, UINT64_C(7000000000) + i * 3, &level);
+    }
+    printf("after cancels: %lu orders, order 7000000003 %s\n", (unsigned long)algokit_hash_u64_size(orders),
+           algokit_hash_u64_get(orders, UINT64_C(7000000003), &level) == 0 ? "found" : "missing");
+
+    /* Destroy both maps; only the generic one owns heap keys and values. */
+    algokit_hash_lp_destroy(generic, free_kv);
+    algokit_hash_u64_destroy(orders);
+    free(probes);
+    return 0;
+}
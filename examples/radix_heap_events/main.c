@@ -0,0 +1,99 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "algokit/radix_heap.h"
+
+/*
+ * Context: a tiny discrete-event simulation of a print shop. Each event has a
+ * timestamp in microseconds; handling an event may schedule later events.
+ * Timestamps never go backwards, so a monotone radix heap replaces a
+ * comparator-based heap and orders events without any callback.
+ */
+
+enum stage { ARRIVE, PRINTED, PICKED_UP };
+
+static const char *stage_names[] = {"arrives", "printed", "picked up"};
+
+struct event {
+    enum stage stage;
+    int job;
+};
+
+static void destroy_event(void *key, void *val) {
+    (void)val;
+    free(key);
+}
+
+static int schedule(algokit_radix_heap *queue, uint64_t when, enum stage stage, int job) {
+    struct event *ev = (struct event *)malloc(sizeof(*ev));
+    Item item;
+
+    if (!ev) {
+        return -1;
+    }
+    ev->stage = stage;
+    ev->job = job;
+    item.key = ev;
+    item.val = NULL;
+    if (algokit_radix_heap_insert(queue, when, item) != 0) {
+        free(ev);
+        return -1;
+    }
+    return 0;
+}
+
+int main(void) {
+    algokit_radix_heap *queue = algokit_radix_heap_create();
+    uint64_t now;
+    Item item;
+    Item late;
+    int job;
+
+    /* Create the event queue before scheduling anything. */
+    if (!queue) {
+        return 1;
+    }
+
+    /* Three jobs arrive at different times. */
+    for (job = 0; job < 3; job++) {
+        if (schedule(queue, (uint64_t)(job * 250), ARRIVE, job) != 0) {
+            algokit_radix_heap_destroy(queue, destroy_event);
+            return 1;
+        }
+    }
+
+    /* Peek at the earliest event without removing it. */
+    if (algokit_radix_heap_peek_min(queue, &now, &item) == 0) {
+        printf("next event at %llu us\n", (unsigned long long)now);
+    }
+
+    /* Process events in time order; arrivals schedule a print, prints schedule a pickup. */
+    while (!algokit_radix_heap_is_empty(queue)) {
+        struct event *ev;
+
+        if (algokit_radix_heap_extract_min(queue, &now, &item) != 0) {
+            break;
+        }
+        ev = (struct event *)item.key;
+        printf("%6llu us: job %d %s\n", (unsigned long long)now, ev->job, stage_names[ev->stage]);
+
+        if (ev->stage == ARRIVE) {
+            schedule(queue, now + 400, PRINTED, ev->job);
+        } else if (ev->stage == PRINTED) {
+            schedule(queue, now + 1000, PICKED_UP, ev->job);
+        }
+        free(ev);
+    }
+
+    /* Events in the past are rejected: the heap is monotone. */
+    late.key = NULL;
+    late.val = NULL;
+    if (algokit_radix_heap_insert(queue, algokit_radix_heap_last(queue) - 1, late) != 0) {
+        printf("rejected event before %llu us\n", (unsigned long long)algokit_radix_heap_last(queue));
+    }
+
+    /* Destroy the queue; pending events (none here) would be freed by the callback. */
+    algokit_radix_heap_destroy(queue, destroy_event);
+    return 0;
+}
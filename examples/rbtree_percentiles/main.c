@@ -0,0 +1,143 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "algokit/rbtree.h"
+
+/*
+ * Context: a latency dashboard keeps the last WINDOW request latencies of a
+ * service in a red-black tree and reports the median, the 99th percentile
+ * and the share of requests under the 5 ms objective after every batch.
+ * Each query is answered with select, rank and count_range in O(log n);
+ * the same report from an in-order traversal is timed for comparison.
+ */
+
+#define WINDOW 100000
+#define REQUESTS 1000000
+#define REPORT_EVERY 10000
+#define SLO_MICROS 5000
+
+/* Latencies repeat, so the arrival number makes every key unique. */
+typedef struct {
+    uint32_t micros;
+    uint32_t seq;
+} sample;
+
+static int sample_cmp(const void *a, const void *b) {
+    const sample *x = (const sample *)a;
+    const sample *y = (const sample *)b;
+    if (x->micros != y->micros) {
+        return x->micros < y->micros ? -1 : 1;
+    }
+    return (x->seq > y->seq) - (x->seq < y->seq);
+}
+
+static double elapsed_ms(clock_t start) {
+    return (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+struct scan_ctx {
+    size_t index;
+    size_t p50;
+    size_t p99;
+    uint32_t p50_micros;
+    uint32_t p99_micros;
+};
+
+static void scan_sample(const Item *item, void *ctx) {
+    struct scan_ctx *scan = (struct scan_ctx *)ctx;
+    const sample *s = (const sample *)item->key;
+    if (scan->index == scan->p50) {
+        scan->p50_micros = s->micros;
+    }
+    if (scan->index == scan->p99) {
+        scan->p99_micros = s->micros;
+    }
+    scan->index++;
+}
+
+int main(void) {
+    sample *ring = (sample *)malloc(WINDOW * sizeof(*ring));
+    algokit_rbtree *window = algokit_rbtree_create(sample_cmp);
+    uint32_t seed = 2463534242u;
+    double query_ms = 0.0;
+    double scan_ms = 0.0;
+    size_t reports = 0;
+    uint32_t p50 = 0;
+    uint32_t p99 = 0;
+    size_t under_slo = 0;
+    size_t slow = 0;
+    clock_t start;
+    Item item;
+    size_t i;
+
+    if (!ring || !window) {
+        free(ring);
+        algokit_rbtree_destroy(window, NULL);
+        return 1;
+    }
+
+    for (i = 0; i < REQUESTS; i++) {
+        sample *slot = &ring[i % WINDOW];
+        uint32_t r;
+
+        /* The oldest sample leaves the window before its ring slot is reused. */
+        if (i >= WINDOW) {
+            algokit_rbtree_remove(window, slot, &item);
+        }
+
+        /* Mostly 1-3 ms, with a slow tail up to about 40 ms. */
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        r = seed % 1000;
+        slot->micros = 1000 + seed % 2000 + (r >= 970 ? (seed >> 10) % 40000 : 0);
+        slot->seq = (uint32_t)i;
+        item.key = slot;
+        item.val = NULL;
+        algokit_rbtree_insert(window, item);
+
+        if ((i + 1) % REPORT_EVERY == 0) {
+            size_t n = algokit_rbtree_size(window);
+            sample slo = {SLO_MICROS, 0};
+            sample tail = {20000, UINT32_MAX};
+            struct scan_ctx scan;
+
+            /* Percentiles by select, SLO share by rank, slow band by count_range. */
+            start = clock();
+            if (algokit_rbtree_select(window, n / 2, &item) == 0) {
+                p50 = ((const sample *)item.key)->micros;
+            }
+            if (algokit_rbtree_select(window, n * 99 / 100, &item) == 0) {
+                p99 = ((const sample *)item.key)->micros;
+            }
+            algokit_rbtree_rank(window, &slo, &under_slo);
+            algokit_rbtree_count_range(window, &slo, &tail, &slow);
+            query_ms += elapsed_ms(start);
+
+            /* The same percentiles from a full in-order walk. */
+            scan.index = 0;
+            scan.p50 = n / 2;
+            scan.p99 = n * 99 / 100;
+            start = clock();
+            algokit_rbtree_traverse_inorder(window, scan_sample, &scan);
+            scan_ms += elapsed_ms(start);
+            if (scan.p50_micros != p50 || scan.p99_micros != p99) {
+                printf("mismatch at request %lu\n", (unsigned long)i);
+            }
+            reports++;
+        }
+    }
+
+    printf("last report over %lu samples: p50 %lu us, p99 %lu us, %.1f%% under %d us, %lu between 5 and 20 ms\n",
+           (unsigned long)algokit_rbtree_size(window), (unsigned long)p50, (unsigned long)p99,
+           100.0 * (double)under_slo / (double)algokit_rbtree_size(window), SLO_MICROS, (unsigned long)slow);
+    printf("%lu reports: %.2f ms with select/rank/count_range, %.1f ms with in-order scans\n", (unsigned long)reports,
+           query_ms, scan_ms);
+
+    /* Samples live in the ring, so the tree owns nothing. */
+    algokit_rbtree_destroy(window, NULL);
+    free(ring);
+    return 0;
+}
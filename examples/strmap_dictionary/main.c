@@ -0,0 +1,116 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "algokit/hash.h"
+#include "algokit/key.h"
+#include "algokit/strmap.h"
+
+/*
+ * Context: dictionary-encode a column of 2 million product codes such as
+ * "SKU-004217-EU": each distinct code gets a small integer ID, and the column
+ * becomes an array of IDs. We encode with the generic table (one malloc per
+ * distinct code, strcmp on every candidate) and with algokit_strmap, which
+ * copies the codes into its arena and compares length, hash, and prefix
+ * before touching key bytes. Then we drop retired codes from the dictionary.
+ */
+
+#define ROWS 2000000
+#define DISTINCT 200000
+
+static double elapsed_ms(clock_t start) {
+    return (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+static void free_key(void *key, void *val) {
+    (void)val;
+    free(key);
+}
+
+int main(void) {
+    static int ids[DISTINCT];
+    static char codes[DISTINCT][16];
+    static size_t lengths[DISTINCT];
+    int *rows = (int *)malloc(ROWS * sizeof(*rows));
+    int *column = (int *)malloc(ROWS * sizeof(*column));
+    algokit_hash_lp *generic = algokit_hash_lp_create(DISTINCT, algokit_key_hash_str, algokit_key_cmp_str);
+    algokit_strmap *dict = algokit_strmap_create(DISTINCT);
+    unsigned seed = 12345u;
+    size_t next_id = 0;
+    clock_t start;
+    char code[32];
+    void *found;
+    Item item;
+    int i;
+
+    /* Create both dictionaries and the encoded column. */
+    if (!rows || !column || !generic || !dict) {
+        free(rows);
+        free(column);
+        algokit_hash_lp_destroy(generic, NULL);
+        algokit_strmap_destroy(dict);
+        return 1;
+    }
+    /* Build the input: row i holds the code codes[rows[i]]. */
+    for (i = 0; i < DISTINCT; i++) {
+        ids[i] = i;
+        lengths[i] = (size_t)sprintf(codes[i], "SKU-%06d-EU", i);
+    }
+    for (i = 0; i < ROWS; i++) {
+        seed = seed * 1103515245u + 12345u;
+        rows[i] = (int)((seed >> 8) % DISTINCT);
+    }
+
+    /* Generic table: look each code up, and copy it to the heap when it is new. */
+    start = clock();
+    for (i = 0; i < ROWS; i++) {
+        const char *code_in = codes[rows[i]];
+        if (algokit_hash_lp_get(generic, code_in, &item) != 0) {
+            char *copy = (char *)malloc(lengths[rows[i]] + 1);
+            if (!copy) {
+                break;
+            }
+            strcpy(copy, code_in);
+            item.key = copy;
+            item.val = &ids[next_id++];
+            algokit_hash_lp_put(generic, item);
+        }
+        column[i] = *(int *)item.val;
+    }
+    printf("generic table: %.1f ms, %lu distinct codes\n", elapsed_ms(start), (unsigned long)next_id);
+
+    /* String map: the same stream, with key bytes copied into the map's arena. */
+    next_id = 0;
+    start = clock();
+    for (i = 0; i < ROWS; i++) {
+        const char *code_in = codes[rows[i]];
+        if (algokit_strmap_get(dict, code_in, lengths[rows[i]], &found) != 0) {
+            found = &ids[next_id++];
+            algokit_strmap_put(dict, code_in, lengths[rows[i]], found);
+        }
+        column[i] = *(int *)found;
+    }
+    printf("strmap:        %.1f ms, %lu distinct codes, %lu arena bytes\n", elapsed_ms(start),
+           (unsigned long)algokit_strmap_size(dict), (unsigned long)algokit_strmap_arena_bytes(dict));
+
+    /* Look one code up again to check the encoding. */
+    sprintf(code, "SKU-%06d-EU", 42);
+    if (algokit_strmap_get(dict, code, strlen(code), &found) == 0) {
+        printf("%s has ID %d\n", code, *(int *)found);
+    }
+
+    /* Retire the codes below 1000; their bytes are reclaimed when the arena next needs room. */
+    for (i = 0; i < 1000; i++) {
+        sprintf(code, "SKU-%06d-EU", i);
+        algokit_strmap_delete(dict, code, strlen(code), &found);
+    }
+    printf("after retiring: %lu codes\n", (unsigned long)algokit_strmap_size(dict));
+
+    /* Destroy both dictionaries; only the generic one owns heap keys. */
+    algokit_hash_lp_destroy(generic, free_key);
+    algokit_strmap_destroy(dict);
+    free(column);
+    free(rows);
+    return 0;
+}
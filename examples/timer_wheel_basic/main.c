@@ -0,0 +1,72 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "algokit/timer_wheel.h"
+
+/*
+ * Context: a server tracks idle timeouts for its connections. Each connection
+ * arms a timer when it goes idle; activity cancels and re-arms the timer, and
+ * the main loop advances the wheel once per millisecond tick. Connection IDs
+ * are the keys; values are unused.
+ */
+
+struct connection {
+    int id;
+    algokit_timer_wheel_timer *timeout;
+};
+
+static void on_timeout(const Item *item, void *ctx) {
+    struct connection *conn = (struct connection *)item->key;
+    algokit_timer_wheel *wheel = (algokit_timer_wheel *)ctx;
+
+    /* The handle is invalid once the timer fired; forget it. */
+    conn->timeout = NULL;
+    printf("tick %llu: connection %d timed out\n", (unsigned long long)algokit_timer_wheel_now(wheel), conn->id);
+}
+
+static int arm(algokit_timer_wheel *wheel, struct connection *conn, uint64_t delay) {
+    Item item;
+
+    item.key = conn;
+    item.val = NULL;
+    return algokit_timer_wheel_schedule(wheel, delay, item, &conn->timeout);
+}
+
+int main(void) {
+    algokit_timer_wheel *wheel = algokit_timer_wheel_create(0);
+    struct connection conns[3] = {{1, NULL}, {2, NULL}, {3, NULL}};
+    Item item;
+    size_t fired;
+
+    /* Create the wheel with the clock starting at tick 0. */
+    if (!wheel) {
+        return 1;
+    }
+
+    /* Arm idle timeouts: short, medium, and one that needs cascading (> 4096 ticks). */
+    if (arm(wheel, &conns[0], 30) != 0 || arm(wheel, &conns[1], 100) != 0 || arm(wheel, &conns[2], 5000) != 0) {
+        algokit_timer_wheel_destroy(wheel, NULL);
+        return 1;
+    }
+    printf("armed %zu timers\n", algokit_timer_wheel_size(wheel));
+
+    /* Connection 1 sees activity at tick 20: cancel its timer and re-arm it. */
+    fired = algokit_timer_wheel_advance(wheel, 20, on_timeout, wheel);
+    if (algokit_timer_wheel_cancel(wheel, conns[0].timeout, &item) == 0) {
+        printf("tick %llu: connection %d active, timer re-armed\n", (unsigned long long)algokit_timer_wheel_now(wheel), ((struct connection *)item.key)->id);
+        arm(wheel, &conns[0], 30);
+    }
+
+    /* Run the clock forward; timers fire exactly at their deadline. */
+    fired += algokit_timer_wheel_advance(wheel, 200, on_timeout, wheel);
+    printf("tick %llu: %zu fired, %zu pending\n", (unsigned long long)algokit_timer_wheel_now(wheel), fired, algokit_timer_wheel_size(wheel));
+
+    /* The long timeout cascades down from the upper levels and fires on time. */
+    fired += algokit_timer_wheel_advance(wheel, 5000, on_timeout, wheel);
+    printf("tick %llu: %zu fired, %zu pending\n", (unsigned long long)algokit_timer_wheel_now(wheel), fired, algokit_timer_wheel_size(wheel));
+
+    /* Destroy the wheel; connections are stack objects, so no destroy callback. */
+    algokit_timer_wheel_destroy(wheel, NULL);
+    return 0;
+}
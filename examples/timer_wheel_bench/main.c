@@ -0,0 +1,182 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "algokit/heap.h"
+#include "algokit/timer_wheel.h"
+
+/*
+ * Context: compare the timing wheel with a binary heap on a timer churn
+ * workload. CONNECTIONS connections each hold an idle timeout; on every tick
+ * ACTIVE_PER_TICK random connections see activity, which cancels and re-arms
+ * their timeout, then the clock advances by one tick.
+ *
+ * The heap cannot cancel in place, so it uses the usual lazy scheme: every
+ * re-arm pushes a new record and bumps the connection's generation; stale
+ * records are discarded when they reach the top of the heap.
+ */
+
+#define CONNECTIONS 50000
+#define TICKS 2000
+#define ACTIVE_PER_TICK 200
+#define MIN_TIMEOUT 500
+#define TIMEOUT_SPREAD 1500
+
+struct heap_record {
+    uint64_t expires;
+    size_t conn;
+    unsigned generation;
+};
+
+static uint64_t rng_state = 88172645463325252u;
+
+static uint64_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+static uint64_t random_timeout(void) {
+    return MIN_TIMEOUT + next_random() % TIMEOUT_SPREAD;
+}
+
+/* Reverse the order so the max-heap yields the earliest deadline first. */
+static int record_cmp(const void *a, const void *b) {
+    uint64_t ea = ((const struct heap_record *)a)->expires;
+    uint64_t eb = ((const struct heap_record *)b)->expires;
+    return (ea < eb) - (ea > eb);
+}
+
+/* The key points at the connection's handle slot; clear it once the timer fired. */
+static void clear_handle(const Item *item, void *ctx) {
+    *(algokit_timer_wheel_timer **)item->key = NULL;
+    (*(size_t *)ctx)++;
+}
+
+static double run_wheel(size_t *expired) {
+    algokit_timer_wheel *wheel = algokit_timer_wheel_create(0);
+    algokit_timer_wheel_timer **handles = (algokit_timer_wheel_timer **)malloc(CONNECTIONS * sizeof(*handles));
+    Item item;
+    clock_t start;
+    size_t i;
+    size_t t;
+
+    if (!wheel || !handles) {
+        algokit_timer_wheel_destroy(wheel, NULL);
+        free(handles);
+        return -1.0;
+    }
+
+    rng_state = 88172645463325252u;
+    *expired = 0;
+    item.val = NULL;
+    start = clock();
+
+    /* Arm one timeout per connection. */
+    for (i = 0; i < CONNECTIONS; i++) {
+        item.key = &handles[i];
+        algokit_timer_wheel_schedule(wheel, random_timeout(), item, &handles[i]);
+    }
+
+    /* Each tick: cancel and re-arm active connections, then advance. */
+    for (t = 0; t < TICKS; t++) {
+        for (i = 0; i < ACTIVE_PER_TICK; i++) {
+            size_t conn = (size_t)(next_random() % CONNECTIONS);
+            if (handles[conn]) {
+                algokit_timer_wheel_cancel(wheel, handles[conn], NULL);
+            }
+            item.key = &handles[conn];
+            algokit_timer_wheel_schedule(wheel, random_timeout(), item, &handles[conn]);
+        }
+        algokit_timer_wheel_advance(wheel, 1, clear_handle, expired);
+    }
+
+    start = clock() - start;
+    algokit_timer_wheel_destroy(wheel, NULL);
+    free(handles);
+    return (double)start / CLOCKS_PER_SEC;
+}
+
+static double run_heap(size_t *expired) {
+    size_t max_records = CONNECTIONS + (size_t)TICKS * ACTIVE_PER_TICK;
+    struct heap_record *records = (struct heap_record *)malloc(max_records * sizeof(*records));
+    unsigned *generations = (unsigned *)calloc(CONNECTIONS, sizeof(*generations));
+    algokit_heap *heap = algokit_heap_create(CONNECTIONS, record_cmp);
+    size_t used = 0;
+    uint64_t now = 0;
+    Item item;
+    clock_t start;
+    size_t i;
+    size_t t;
+
+    if (!records || !generations || !heap) {
+        free(records);
+        free(generations);
+        algokit_heap_destroy(heap, NULL);
+        return -1.0;
+    }
+
+    rng_state = 88172645463325252u;
+    *expired = 0;
+    item.val = NULL;
+    start = clock();
+
+    for (i = 0; i < CONNECTIONS; i++) {
+        records[used].expires = now + random_timeout();
+        records[used].conn = i;
+        records[used].generation = 0;
+        item.key = &records[used++];
+        algokit_heap_insert(heap, item);
+    }
+
+    for (t = 0; t < TICKS; t++) {
+        for (i = 0; i < ACTIVE_PER_TICK; i++) {
+            size_t conn = (size_t)(next_random() % CONNECTIONS);
+            records[used].expires = now + random_timeout();
+            records[used].conn = conn;
+            records[used].generation = ++generations[conn];
+            item.key = &records[used++];
+            algokit_heap_insert(heap, item);
+        }
+        now++;
+        while (algokit_heap_peek(heap, &item) == 0 && ((struct heap_record *)item.key)->expires <= now) {
+            struct heap_record *rec;
+            algokit_heap_extract(heap, &item);
+            rec = (struct heap_record *)item.key;
+            if (rec->generation == generations[rec->conn]) {
+                (*expired)++;
+            }
+        }
+    }
+
+    start = clock() - start;
+    algokit_heap_destroy(heap, NULL);
+    free(records);
+    free(generations);
+    return (double)start / CLOCKS_PER_SEC;
+}
+
+int main(void) {
+    size_t wheel_expired;
+    size_t heap_expired;
+    double wheel_time;
+    double heap_time;
+
+    /* Both runs replay the same random sequence, so they must expire the same timers. */
+    wheel_time = run_wheel(&wheel_expired);
+    heap_time = run_heap(&heap_expired);
+    if (wheel_time < 0.0 || heap_time < 0.0) {
+        return 1;
+    }
+
+    printf("workload: %d connections, %d ticks, %d re-arms per tick\n", CONNECTIONS, TICKS, ACTIVE_PER_TICK);
+    printf("timer wheel: %.3f s, %zu expired\n", wheel_time, wheel_expired);
+    printf("binary heap: %.3f s, %zu expired\n", heap_time, heap_expired);
+    if (wheel_expired != heap_expired) {
+        printf("mismatch between implementations\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,88 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "algokit/topk.h"
+
+/*
+ * Context: find the 5 slowest requests in a stream of request latencies.
+ * The stream is split across 3 workers; each worker keeps its own bounded
+ * collector (in a real service, one per thread), and the partial results are
+ * merged at the end. Keys are latencies in microseconds; values are request IDs.
+ */
+
+#define WORKERS 3
+#define TOP 5
+#define REQUESTS 30
+
+struct request {
+    int latency_us;
+    int id;
+};
+
+static int latency_cmp(const void *a, const void *b) {
+    int va = *(const int *)a;
+    int vb = *(const int *)b;
+    return (va > vb) - (va < vb);
+}
+
+int main(void) {
+    static struct request requests[REQUESTS];
+    algokit_topk *workers[WORKERS];
+    Item slowest[TOP];
+    Item item;
+    Item dropped;
+    size_t count;
+    size_t rejected = 0;
+    int i;
+
+    /* Build a deterministic stream of latencies. */
+    for (i = 0; i < REQUESTS; i++) {
+        requests[i].id = 1000 + i;
+        requests[i].latency_us = (i * 7919) % 997;
+    }
+
+    /* Create one collector per worker. */
+    for (i = 0; i < WORKERS; i++) {
+        workers[i] = algokit_topk_create(TOP, latency_cmp);
+        if (!workers[i]) {
+            while (i-- > 0) {
+                algokit_topk_destroy(workers[i], NULL);
+            }
+            return 1;
+        }
+    }
+
+    /* Each worker offers its share of the stream; most items are rejected at the root. */
+    for (i = 0; i < REQUESTS; i++) {
+        item.key = &requests[i].latency_us;
+        item.val = &requests[i].id;
+        if (algokit_topk_offer(workers[i % WORKERS], item, &dropped) == 1) {
+            rejected++;
+        }
+    }
+    printf("offered %d requests, %zu dropped by the workers\n", REQUESTS, rejected);
+
+    /* The weakest retained item is the admission threshold. */
+    if (algokit_topk_threshold(workers[0], &item) == 0) {
+        printf("worker 0 admits latencies above %d us\n", *(int *)item.key);
+    }
+
+    /* Merge the partial results into worker 0; losers need no cleanup here. */
+    for (i = 1; i < WORKERS; i++) {
+        algokit_topk_merge(workers[0], workers[i], NULL);
+    }
+
+    /* Drain the final result, slowest first. */
+    if (algokit_topk_drain_sorted(workers[0], slowest, &count) == 0) {
+        size_t j;
+        for (j = 0; j < count; j++) {
+            printf("#%zu: request %d took %d us\n", j + 1, *(int *)slowest[j].val, *(int *)slowest[j].key);
+        }
+    }
+
+    /* Destroy the collectors; the request array is static. */
+    for (i = 0; i < WORKERS; i++) {
+        algokit_topk_destroy(workers[i], NULL);
+    }
+    return 0;
+}
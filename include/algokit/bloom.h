@@ -0,0 +1,55 @@
+#ifndef ALGOKIT_BLOOM_H
+#define ALGOKIT_BLOOM_H
+
+#include <stddef.h>
+#include "algokit/hash.h"
+#include "algokit/item.h"
+
+/*
+ * Blocked Bloom filter
+ * A set of key hashes answering "definitely absent" or "maybe present".
+ * The filter is an array of 32-byte blocks of eight 32-bit words; a key
+ * picks one block and sets one bit in each of its eight words, so add and
+ * test touch a single cache line and the eight word tests are independent
+ * (the compiler can vectorize them). Keys cannot be removed: rebuild the
+ * filter after many deletes from the table it guards.
+ * Sizing: create picks the smallest block count whose expected false
+ * positive rate for expected_items keys is at most fp_rate.
+ * Complexity: add/maybe_contains O(1), one cache line each.
+ * Ownership: the filter stores bits only, never keys or values.
+ */
+
+typedef struct algokit_bloom algokit_bloom;
+
+algokit_bloom *algokit_bloom_create(size_t expected_items, double fp_rate);
+
+/* Creates a filter sized for count items and adds hash(items[i].key) for each. */
+algokit_bloom *algokit_bloom_build(const Item *items, size_t count, algokit_key_hash_fn hash, double fp_rate);
+
+void algokit_bloom_destroy(algokit_bloom *bloom);
+
+int algokit_bloom_add(algokit_bloom *bloom, size_t hash);
+
+/* Returns 1 if hash may have been added, 0 if it certainly was not. */
+int algokit_bloom_maybe_contains(const algokit_bloom *bloom, size_t hash);
+
+void algokit_bloom_clear(algokit_bloom *bloom);
+
+size_t algokit_bloom_bytes(const algokit_bloom *bloom);
+
+/*
+ * Filter in front of a hash table: the key is hashed once with hash (the
+ * table's own hash function), the filter answers most misses, and the table
+ * is only probed when the filter says "maybe". Return codes follow the
+ * table's put/get. The filter must have seen every key in the table, so
+ * insert through *_put here or build the filter from the table's items.
+ */
+int algokit_bloom_hash_lp_put(algokit_bloom *bloom, algokit_hash_lp *table, algokit_key_hash_fn hash, Item item);
+int algokit_bloom_hash_lp_get(const algokit_bloom *bloom, const algokit_hash_lp *table, algokit_key_hash_fn hash,
+                              const void *key, Item *out);
+
+int algokit_bloom_hash_sc_put(algokit_bloom *bloom, algokit_hash_sc *table, algokit_key_hash_fn hash, Item item);
+int algokit_bloom_hash_sc_get(const algokit_bloom *bloom, const algokit_hash_sc *table, algokit_key_hash_fn hash,
+                              const void *key, Item *out);
+
+#endif /* ALGOKIT_BLOOM_H */
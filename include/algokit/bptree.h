@@ -0,0 +1,43 @@
+#ifndef ALGOKIT_BPTREE_H
+#define ALGOKIT_BPTREE_H
+
+#include <stddef.h>
+#include "algokit/item.h"
+
+/*
+ * B+tree ordered map
+ * Invariant: all items sit in leaves at the same depth, in key order; each
+ * leaf links to the next one; an internal node with k keys has k + 1
+ * children, and its key i is the smallest key under child i + 1.
+ * Layout: every node is 256 bytes (four 64-byte cache lines on 64-bit
+ * targets), aligned to a cache line. A node keeps up to 15 key pointers in
+ * one contiguous array searched by binary search; leaves keep the values in
+ * a parallel array, internal nodes keep 16 child pointers.
+ * Complexity: search/insert/remove O(log n) comparisons and O(log16 n) node
+ * visits; a range scan visits O(log16 n + k / 8) nodes for k items.
+ * Ownership: tree owns only its nodes; user data freed via destroy callback.
+ */
+
+typedef struct algokit_bptree algokit_bptree;
+
+typedef void (*algokit_bptree_visit_fn)(const Item *item, void *ctx);
+
+algokit_bptree *algokit_bptree_create(algokit_key_cmp_fn cmp);
+
+void algokit_bptree_destroy(algokit_bptree *tree, algokit_item_destroy_fn destroy);
+
+int algokit_bptree_insert(algokit_bptree *tree, Item item);
+
+int algokit_bptree_search(const algokit_bptree *tree, const void *key, Item *out);
+
+int algokit_bptree_remove(algokit_bptree *tree, const void *key, Item *out);
+
+size_t algokit_bptree_size(const algokit_bptree *tree);
+
+int algokit_bptree_traverse_inorder(const algokit_bptree *tree, algokit_bptree_visit_fn visit, void *ctx);
+
+/* Visits items with lo <= key <= hi in ascending order; a NULL bound is open. */
+int algokit_bptree_range(const algokit_bptree *tree, const void *lo, const void *hi, algokit_bptree_visit_fn visit,
+                         void *ctx);
+
+#endif /* ALGOKIT_BPTREE_H */
@@ -0,0 +1,55 @@
+#ifndef ALGOKIT_CACHE_H
+#define ALGOKIT_CACHE_H
+
+#include <stddef.h>
+#include "algokit/item.h"
+
+/*
+ * Bounded key/value cache
+ * A separate chaining table maps each key to one of capacity preallocated
+ * entries; when the cache is full, a put evicts one entry chosen by the
+ * replacement policy:
+ * - ALGOKIT_CACHE_LRU: entries sit on an intrusive doubly linked recency
+ *   list; a hit moves its entry to the front, eviction takes the back.
+ * - ALGOKIT_CACHE_CLOCK: entries form a ring with one reference bit each; a
+ *   hit only sets the bit (no link writes), eviction advances a hand that
+ *   clears set bits and takes the first entry whose bit is clear.
+ * Complexity: get/put/delete O(1) expected; a CLOCK eviction is O(1)
+ * amortized (each hand step clears a bit set by an earlier hit).
+ * Ownership: the cache never frees keys or values itself; evicted items are
+ * passed to the evict callback given at create, if any.
+ */
+
+#define ALGOKIT_CACHE_LRU 0
+#define ALGOKIT_CACHE_CLOCK 1
+
+typedef struct algokit_cache algokit_cache;
+
+typedef struct {
+    size_t hits;
+    size_t misses;
+    size_t inserts;
+    size_t evictions;
+} algokit_cache_stats;
+
+algokit_cache *algokit_cache_create(size_t capacity, int policy, algokit_key_hash_fn hash, algokit_key_cmp_fn cmp,
+                                    algokit_item_destroy_fn evict);
+
+void algokit_cache_destroy(algokit_cache *cache, algokit_item_destroy_fn destroy);
+
+/* Returns 0 if inserted (evicting an entry when full), 1 if the key is already cached. */
+int algokit_cache_put(algokit_cache *cache, Item item);
+
+/* A hit refreshes the entry under the cache's policy, so the cache is not const. */
+int algokit_cache_get(algokit_cache *cache, const void *key, Item *out);
+
+/* Removes an entry without calling the evict callback. */
+int algokit_cache_delete(algokit_cache *cache, const void *key, Item *out);
+
+size_t algokit_cache_size(const algokit_cache *cache);
+
+size_t algokit_cache_capacity(const algokit_cache *cache);
+
+int algokit_cache_get_stats(const algokit_cache *cache, algokit_cache_stats *out);
+
+#endif /* ALGOKIT_CACHE_H */
@@ -5,15 +5,58 @@
 #include "algokit/item.h"
 
 /*
- * Hash tables with two implementations:
+ * Hash tables with six implementations:
  * - Linear probing
  * - Separate chaining
+ * - SwissTable-style open addressing (1-byte control tags probed 16 at a time)
+ * - Robin Hood open addressing (probe distances, no tombstones)
+ * - Bucketed chaining (cache-line blocks of 3 items with 8-bit fingerprints)
+ * - Cuckoo hashing (two candidate buckets of 4 items, bounded lookups)
  *
  * Keys are hashed by the user-provided hash function and compared by cmp.
  */
 
 typedef struct algokit_hash_lp algokit_hash_lp;
 typedef struct algokit_hash_sc algokit_hash_sc;
+typedef struct algokit_hash_sw algokit_hash_sw;
+typedef struct algokit_hash_rh algokit_hash_rh;
+typedef struct algokit_hash_bc algokit_hash_bc;
+typedef struct algokit_hash_ck algokit_hash_ck;
+
+/*
+ * Iteration cursor for the linear probing and separate chaining tables.
+ * Start with *_first and continue with *_next; both return 0 with an item,
+ * 1 at the end, and nonzero negative on error. Items come in slot order.
+ * Any put, delete, reserve, shrink_to_fit or clear invalidates the cursor.
+ */
+typedef struct {
+    size_t index;
+    const void *node;
+} algokit_hash_cursor;
+
+/*
+ * Health statistics for the linear probing and separate chaining tables,
+ * filled by *_stats in one pass over the table (no hash or cmp calls).
+ * The probe length of an item is the number of slots (lp) or chain nodes
+ * (sc) a successful lookup inspects: 1 means it sits where its hash points.
+ * probe_histogram[i] counts items with probe length i + 1; the last entry
+ * also counts every longer probe. For sc it equals the number of chains
+ * holding more than i items. tombstones is always 0 for sc. grow_count and
+ * shrink_count count resizes since the table was created.
+ */
+#define ALGOKIT_HASH_STATS_HISTOGRAM 16
+
+typedef struct {
+    size_t size;
+    size_t capacity;
+    double load_factor;
+    size_t tombstones;
+    double avg_probe;
+    size_t max_probe;
+    size_t probe_histogram[ALGOKIT_HASH_STATS_HISTOGRAM];
+    size_t grow_count;
+    size_t shrink_count;
+} algokit_hash_stats;
 
 /* Linear probing */
 algokit_hash_lp *algokit_hash_lp_create(size_t capacity, algokit_key_hash_fn hash, algokit_key_cmp_fn cmp);
@@ -21,6 +64,49 @@ void algokit_hash_lp_destroy(algokit_hash_lp *table, algokit_item_destroy_fn des
 int algokit_hash_lp_put(algokit_hash_lp *table, Item item);
 int algokit_hash_lp_get(const algokit_hash_lp *table, const void *key, Item *out);
 int algokit_hash_lp_delete(algokit_hash_lp *table, const void *key, Item *out);
+size_t algokit_hash_lp_size(const algokit_hash_lp *table);
+size_t algokit_hash_lp_capacity(const algokit_hash_lp *table);
+int algokit_hash_lp_first(const algokit_hash_lp *table, algokit_hash_cursor *cursor, Item *out);
+int algokit_hash_lp_next(const algokit_hash_lp *table, algokit_hash_cursor *cursor, Item *out);
+
+/*
+ * reserve(n) allocates once so that n items fit without another resize;
+ * shrink_to_fit rebuilds at the smallest capacity for the current size and
+ * drops tombstones; clear empties the table and keeps its allocation.
+ */
+int algokit_hash_lp_reserve(algokit_hash_lp *table, size_t count);
+int algokit_hash_lp_shrink_to_fit(algokit_hash_lp *table);
+void algokit_hash_lp_clear(algokit_hash_lp *table, algokit_item_destroy_fn destroy);
+
+/*
+ * Batch APIs: keys are hashed and their home slots prefetched 16 at a time
+ * before any probe runs, so cache misses overlap on tables larger than the
+ * cache. results[i] receives what get/put would return for entry i; the call
+ * returns nonzero if any entry failed.
+ */
+int algokit_hash_lp_get_batch(const algokit_hash_lp *table, const void *const *keys, size_t count, Item *out, int *results);
+int algokit_hash_lp_put_batch(algokit_hash_lp *table, const Item *items, size_t count, int *results);
+
+/*
+ * Variants taking the key's hash from the caller, for callers that already
+ * computed it (e.g. to consult a filter first). hash must equal the value
+ * the table's hash function returns for the key.
+ */
+int algokit_hash_lp_put_with_hash(algokit_hash_lp *table, Item item, size_t hash);
+int algokit_hash_lp_get_with_hash(const algokit_hash_lp *table, const void *key, size_t hash, Item *out);
+int algokit_hash_lp_delete_with_hash(algokit_hash_lp *table, const void *key, size_t hash, Item *out);
+
+/*
+ * Incremental resize mode (off by default). When enabled, a resize allocates
+ * the new array and keeps the old one: each later put/delete moves a bounded
+ * number of old slots, and get checks both arrays until the old one is empty.
+ * Both arrays stay allocated until the migration ends, in exchange for no
+ * put/delete ever rehashing the whole table at once.
+ * Disabling the mode finishes any pending migration immediately.
+ */
+int algokit_hash_lp_set_incremental(algokit_hash_lp *table, int enabled);
+
+int algokit_hash_lp_stats(const algokit_hash_lp *table, algokit_hash_stats *out);
 
 /* Separate chaining */
 algokit_hash_sc *algokit_hash_sc_create(size_t capacity, algokit_key_hash_fn hash, algokit_key_cmp_fn cmp);
@@ -28,5 +114,83 @@ void algokit_hash_sc_destroy(algokit_hash_sc *table, algokit_item_destroy_fn des
 int algokit_hash_sc_put(algokit_hash_sc *table, Item item);
 int algokit_hash_sc_get(const algokit_hash_sc *table, const void *key, Item *out);
 int algokit_hash_sc_delete(algokit_hash_sc *table, const void *key, Item *out);
+size_t algokit_hash_sc_size(const algokit_hash_sc *table);
+size_t algokit_hash_sc_capacity(const algokit_hash_sc *table);
+int algokit_hash_sc_first(const algokit_hash_sc *table, algokit_hash_cursor *cursor, Item *out);
+int algokit_hash_sc_next(const algokit_hash_sc *table, algokit_hash_cursor *cursor, Item *out);
+int algokit_hash_sc_reserve(algokit_hash_sc *table, size_t count);
+/* shrink_to_fit also moves the nodes into fresh slabs, releasing those of deleted nodes; clear keeps the slabs. */
+int algokit_hash_sc_shrink_to_fit(algokit_hash_sc *table);
+void algokit_hash_sc_clear(algokit_hash_sc *table, algokit_item_destroy_fn destroy);
+
+/* Batch APIs with the same contract as the linear probing ones; bucket heads and first nodes are prefetched. */
+int algokit_hash_sc_get_batch(const algokit_hash_sc *table, const void *const *keys, size_t count, Item *out, int *results);
+int algokit_hash_sc_put_batch(algokit_hash_sc *table, const Item *items, size_t count, int *results);
+
+/* Caller-hashed variants with the same contract as the linear probing ones. */
+int algokit_hash_sc_put_with_hash(algokit_hash_sc *table, Item item, size_t hash);
+int algokit_hash_sc_get_with_hash(const algokit_hash_sc *table, const void *key, size_t hash, Item *out);
+int algokit_hash_sc_delete_with_hash(algokit_hash_sc *table, const void *key, size_t hash, Item *out);
+
+int algokit_hash_sc_stats(const algokit_hash_sc *table, algokit_hash_stats *out);
+
+/*
+ * SwissTable-style open addressing
+ * A separate array holds one control byte per slot: 7 bits of the hash for
+ * full slots, or an EMPTY/DELETED marker. Groups of 16 control bytes are
+ * compared at once (SSE2 when available), so cmp only runs on tag matches.
+ * The capacity is rounded up to a power of two (at least 16); the table
+ * grows at 7/8 load.
+ */
+algokit_hash_sw *algokit_hash_sw_create(size_t capacity, algokit_key_hash_fn hash, algokit_key_cmp_fn cmp);
+void algokit_hash_sw_destroy(algokit_hash_sw *table, algokit_item_destroy_fn destroy);
+int algokit_hash_sw_put(algokit_hash_sw *table, Item item);
+int algokit_hash_sw_get(const algokit_hash_sw *table, const void *key, Item *out);
+int algokit_hash_sw_delete(algokit_hash_sw *table, const void *key, Item *out);
+
+/*
+ * Robin Hood open addressing
+ * Each slot stores its distance from the home slot; inserts displace entries
+ * closer to home, so a lookup stops once it passes the distance the key
+ * would have. Deletes shift the following run back by one slot instead of
+ * leaving tombstones. Capacity is a power of two (at least 16); the table
+ * grows past 7/8 load and shrinks below 1/8, so put/delete churn near either
+ * threshold never triggers back-to-back rehashes.
+ */
+algokit_hash_rh *algokit_hash_rh_create(size_t capacity, algokit_key_hash_fn hash, algokit_key_cmp_fn cmp);
+void algokit_hash_rh_destroy(algokit_hash_rh *table, algokit_item_destroy_fn destroy);
+int algokit_hash_rh_put(algokit_hash_rh *table, Item item);
+int algokit_hash_rh_get(const algokit_hash_rh *table, const void *key, Item *out);
+int algokit_hash_rh_delete(algokit_hash_rh *table, const void *key, Item *out);
+
+/*
+ * Bucketed chaining
+ * Each bucket is a 64-byte block holding up to 3 items, one fingerprint byte
+ * per item, and a pointer to an overflow block taken from a slab pool. A
+ * lookup compares fingerprints first and usually reads a single cache line.
+ * The capacity is rounded up to a power of two (at least 8 buckets); the
+ * table grows past 2 items per bucket and shrinks below 1/4 item per bucket.
+ * Blocks keep no full hash, so resizing calls hash again for every item.
+ */
+algokit_hash_bc *algokit_hash_bc_create(size_t capacity, algokit_key_hash_fn hash, algokit_key_cmp_fn cmp);
+void algokit_hash_bc_destroy(algokit_hash_bc *table, algokit_item_destroy_fn destroy);
+int algokit_hash_bc_put(algokit_hash_bc *table, Item item);
+int algokit_hash_bc_get(const algokit_hash_bc *table, const void *key, Item *out);
+int algokit_hash_bc_delete(algokit_hash_bc *table, const void *key, Item *out);
+
+/*
+ * Cuckoo hashing
+ * Every key has two candidate buckets of 4 items (64 bytes each); a lookup
+ * checks the 8-bit tags of those two buckets, reads an item only on a tag
+ * match, and then scans a small stash that is usually empty. Inserts move
+ * items to their other bucket along the shortest path found by a
+ * breadth-first search; items that find no path go to the stash. The table
+ * grows at 90% load or when the stash is full, and halves below 1/8 load.
+ */
+algokit_hash_ck *algokit_hash_ck_create(size_t capacity, algokit_key_hash_fn hash, algokit_key_cmp_fn cmp);
+void algokit_hash_ck_destroy(algokit_hash_ck *table, algokit_item_destroy_fn destroy);
+int algokit_hash_ck_put(algokit_hash_ck *table, Item item);
+int algokit_hash_ck_get(const algokit_hash_ck *table, const void *key, Item *out);
+int algokit_hash_ck_delete(algokit_hash_ck *table, const void *key, Item *out);
 
 #endif /* ALGOKIT_HASH_H */
@@ -0,0 +1,58 @@
+#ifndef ALGOKIT_HASH_CC_H
+#define ALGOKIT_HASH_CC_H
+
+#include <stddef.h>
+#include "algokit/item.h"
+
+/*
+ * Concurrent sharded hash map (POSIX threads)
+ * Keys are spread over a power-of-two number of shards; each shard is an
+ * open-addressing table with its own writer mutex and sequence counter, and
+ * resizes on its own schedule.
+ * Readers registered with algokit_hash_cc_reader_create take no lock: they
+ * read the shard optimistically and retry if its sequence counter moved
+ * (seqlock). Deleted items and replaced arrays are only freed after every
+ * reader that could still see them has left its read section (epoch-based
+ * reclamation); deleted items then go to the retire callback given to create.
+ * Complexity: put/get/delete O(1) expected; size O(shards).
+ * Ownership: once deleted, an item belongs to the map until it is passed to
+ * retire; destroy must not race with any other call.
+ */
+
+typedef struct algokit_hash_cc algokit_hash_cc;
+
+typedef struct algokit_hash_cc_reader algokit_hash_cc_reader;
+
+/* retire may be NULL when keys and values are never freed (e.g. static storage). */
+algokit_hash_cc *algokit_hash_cc_create(size_t shards, size_t capacity, algokit_key_hash_fn hash, algokit_key_cmp_fn cmp,
+                                        algokit_item_destroy_fn retire);
+
+void algokit_hash_cc_destroy(algokit_hash_cc *table, algokit_item_destroy_fn destroy);
+
+/* One reader per thread; a reader must not be used by two threads at once. */
+algokit_hash_cc_reader *algokit_hash_cc_reader_create(algokit_hash_cc *table);
+
+void algokit_hash_cc_reader_destroy(algokit_hash_cc *table, algokit_hash_cc_reader *reader);
+
+/*
+ * Read section: items returned by get between enter and leave stay readable
+ * until leave, even if another thread deletes them. Sections nest; keep them
+ * short, since no deleted item is retired while any section is open.
+ */
+void algokit_hash_cc_reader_enter(const algokit_hash_cc *table, algokit_hash_cc_reader *reader);
+
+void algokit_hash_cc_reader_leave(const algokit_hash_cc *table, algokit_hash_cc_reader *reader);
+
+int algokit_hash_cc_put(algokit_hash_cc *table, Item item);
+
+/* reader may be NULL: the lookup then takes the shard's writer mutex. */
+int algokit_hash_cc_get(const algokit_hash_cc *table, algokit_hash_cc_reader *reader, const void *key, Item *out);
+
+/* out may be NULL; the removed item is handed to retire after a grace period. */
+int algokit_hash_cc_delete(algokit_hash_cc *table, const void *key, Item *out);
+
+size_t algokit_hash_cc_size(const algokit_hash_cc *table);
+
+size_t algokit_hash_cc_shard_count(const algokit_hash_cc *table);
+
+#endif /* ALGOKIT_HASH_CC_H */
@@ -0,0 +1,49 @@
+#ifndef ALGOKIT_HASH_FROZEN_H
+#define ALGOKIT_HASH_FROZEN_H
+
+#include <stddef.h>
+#include "algokit/hash.h"
+
+/*
+ * Frozen (read-only) hash table built from a linear probing table
+ * A minimal perfect hash (PTHash-style: keys are grouped into buckets and
+ * each bucket stores a 32-bit pilot chosen so that all keys land in free
+ * slots) maps the n keys to slots 0..n-1 with no collisions. Pilots are
+ * searched over n / 0.99 positions, and the keys that land past n - 1 are
+ * remapped to the free slots below it. A lookup computes one slot from the
+ * key's hash and that bucket's pilot and checks that single slot with cmp.
+ * Complexity: freeze O(n) expected (load 0.99 bounds the pilot search per
+ * bucket); get O(1) worst case; about 8.3 bits of index per key plus one
+ * Item per key.
+ * Ownership: the frozen table copies the Items (key/val pointers) of the
+ * source table; the source table can be destroyed, but only one of the two
+ * may be destroyed with a destroy callback.
+ * The index can be written to a flat image and used in place, e.g. from a
+ * memory-mapped file, with algokit_hash_frozen_image_index.
+ */
+
+typedef struct algokit_hash_frozen algokit_hash_frozen;
+
+/* hash and cmp must be the functions the table was created with. */
+algokit_hash_frozen *algokit_hash_freeze(const algokit_hash_lp *table, algokit_key_hash_fn hash, algokit_key_cmp_fn cmp);
+
+void algokit_hash_frozen_destroy(algokit_hash_frozen *frozen, algokit_item_destroy_fn destroy);
+
+int algokit_hash_frozen_get(const algokit_hash_frozen *frozen, const void *key, Item *out);
+
+size_t algokit_hash_frozen_size(const algokit_hash_frozen *frozen);
+
+int algokit_hash_frozen_item_at(const algokit_hash_frozen *frozen, size_t index, Item *out);
+
+/*
+ * Index image: a header followed by the pilots, in native byte order.
+ * image_index maps a hash value to its slot in 0..n-1 without checking that
+ * the key was part of the frozen set; compare the key stored at that slot.
+ */
+size_t algokit_hash_frozen_image_size(const algokit_hash_frozen *frozen);
+
+int algokit_hash_frozen_write_image(const algokit_hash_frozen *frozen, void *buf, size_t size);
+
+int algokit_hash_frozen_image_index(const void *image, size_t size, size_t hash, size_t *index);
+
+#endif /* ALGOKIT_HASH_FROZEN_H */
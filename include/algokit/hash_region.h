@@ -0,0 +1,42 @@
+#ifndef ALGOKIT_HASH_REGION_H
+#define ALGOKIT_HASH_REGION_H
+
+#include <stddef.h>
+
+/*
+ * Position-independent hash table in a caller-provided memory region
+ * Header, slots, and key/value bytes all live in one contiguous buffer and
+ * refer to each other by offsets from its start, so the buffer can be
+ * copied, written to a file, or mapped at different addresses in several
+ * processes (e.g. a shm_open/mmap segment) and queried in place.
+ * One writer builds the table with put and then seals it; open checks the
+ * header of a sealed region, and get bounds-checks every slot it reads
+ * against the data area, so a corrupt region yields -1, never a read
+ * outside the region. Keys and values are byte ranges copied into
+ * the region; values start 8-byte aligned so small structs can be read in
+ * place. Linear probing over a fixed power-of-two slot count (at most 3/4
+ * full); there is no delete and the region never grows.
+ * Complexity: put/get O(1) expected plus O(len) to hash and compare the key.
+ * Ownership: the caller owns the buffer; the handle is the buffer itself,
+ * so it stays valid exactly as long as the mapping does.
+ */
+
+typedef struct algokit_hash_region algokit_hash_region;
+
+size_t algokit_hash_region_bytes(size_t capacity, size_t data_bytes);
+
+algokit_hash_region *algokit_hash_region_init(void *base, size_t size, size_t capacity);
+
+int algokit_hash_region_put(algokit_hash_region *region, const void *key, size_t key_len, const void *val,
+                            size_t val_len);
+
+int algokit_hash_region_seal(algokit_hash_region *region);
+
+const algokit_hash_region *algokit_hash_region_open(const void *base, size_t size);
+
+int algokit_hash_region_get(const algokit_hash_region *region, const void *key, size_t key_len, const void **val,
+                            size_t *val_len);
+
+size_t algokit_hash_region_count(const algokit_hash_region *region);
+
+#endif /* ALGOKIT_HASH_REGION_H */
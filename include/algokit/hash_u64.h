@@ -0,0 +1,33 @@
+#ifndef ALGOKIT_HASH_U64_H
+#define ALGOKIT_HASH_U64_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Integer-keyed hash map (uint64_t -> uint64_t)
+ * Linear probing over 16-byte slots that hold the key and value inline: no
+ * Item, no hash or cmp callback, and a hit reads a single slot. Key 0 marks
+ * an empty slot, so an entry with key 0 is kept outside the slot array.
+ * Deletes shift the following run back instead of leaving tombstones.
+ * Capacity is a power of two (at least 8); the map grows past 3/4 load and
+ * shrinks below 1/8.
+ * Complexity: put/get/delete O(1) expected.
+ * Ownership: keys and values are copied; store pointers as uintptr_t values.
+ */
+
+typedef struct algokit_hash_u64 algokit_hash_u64;
+
+algokit_hash_u64 *algokit_hash_u64_create(size_t capacity);
+
+void algokit_hash_u64_destroy(algokit_hash_u64 *map);
+
+int algokit_hash_u64_put(algokit_hash_u64 *map, uint64_t key, uint64_t val);
+
+int algokit_hash_u64_get(const algokit_hash_u64 *map, uint64_t key, uint64_t *out);
+
+int algokit_hash_u64_delete(algokit_hash_u64 *map, uint64_t key, uint64_t *out);
+
+size_t algokit_hash_u64_size(const algokit_hash_u64 *map);
+
+#endif /* ALGOKIT_HASH_U64_H */
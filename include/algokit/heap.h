@@ -5,9 +5,9 @@
 #include "algokit/item.h"
 
 /*
- * Binary max-heap
- * Invariant: parent key >= child keys according to cmp.
- * Complexity: insert/extract O(log n), peek O(1), size/is_empty O(1).
+ * Binary max-heap (min-heap when created with algokit_heap_create_min)
+ * Invariant: parent key >= child keys according to cmp (<= for a min-heap).
+ * Complexity: insert/extract/replace_top O(log n), peek O(1), size/is_empty O(1).
  * Ownership: heap owns only its internal array; user data freed via destroy callback.
  */
 
@@ -15,12 +15,16 @@ typedef struct algokit_heap algokit_heap;
 
 algokit_heap *algokit_heap_create(size_t capacity, algokit_key_cmp_fn cmp);
 
+algokit_heap *algokit_heap_create_min(size_t capacity, algokit_key_cmp_fn cmp);
+
 void algokit_heap_destroy(algokit_heap *heap, algokit_item_destroy_fn destroy);
 
 int algokit_heap_insert(algokit_heap *heap, Item item);
 
 int algokit_heap_extract(algokit_heap *heap, Item *out);
 
+int algokit_heap_replace_top(algokit_heap *heap, Item item, Item *out);
+
 int algokit_heap_peek(const algokit_heap *heap, Item *out);
 
 size_t algokit_heap_size(const algokit_heap *heap);
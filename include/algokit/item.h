@@ -22,6 +22,9 @@ typedef struct {
  * - Comparison returns <0, 0, >0 for less/equal/greater keys.
  * - Hash returns a stable hash for a key.
  * - Destroy releases key/val ownership when the user requests it.
+ * - For integer, pointer and string keys, prefer the vetted callbacks in
+ *   algokit/key.h over hand-written ones: weak hashes (identity, sums) cluster
+ *   in open-addressing tables and degrade lookups to linear scans.
  */
 
 typedef int (*algokit_key_cmp_fn)(const void *a, const void *b);
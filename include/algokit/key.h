@@ -0,0 +1,34 @@
+#ifndef ALGOKIT_KEY_H
+#define ALGOKIT_KEY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "algokit/item.h"
+
+/*
+ * Ready-made hash functions and comparators for common key types
+ * The algokit_key_hash_* functions match algokit_key_hash_fn and the
+ * algokit_key_cmp_* functions match algokit_key_cmp_fn, so they can be passed
+ * straight to the hash tables and graphs. Integer keys go through a 64-bit
+ * finalizer (every input bit affects every output bit); byte strings use a
+ * wyhash-style multiply-fold hash that reads 16-48 bytes per step.
+ * Keys are read through the key pointer: u32/u64/str expect key to point at
+ * the value, ptr treats the key pointer itself as the value.
+ * Hash values depend on byte order and word size; do not persist them.
+ */
+
+uint64_t algokit_key_mix64(uint64_t x);
+
+uint64_t algokit_key_hash_bytes(const void *data, size_t len, uint64_t seed);
+
+size_t algokit_key_hash_u32(const void *key);
+size_t algokit_key_hash_u64(const void *key);
+size_t algokit_key_hash_ptr(const void *key);
+size_t algokit_key_hash_str(const void *key);
+
+int algokit_key_cmp_u32(const void *a, const void *b);
+int algokit_key_cmp_u64(const void *a, const void *b);
+int algokit_key_cmp_ptr(const void *a, const void *b);
+int algokit_key_cmp_str(const void *a, const void *b);
+
+#endif /* ALGOKIT_KEY_H */
@@ -0,0 +1,36 @@
+#ifndef ALGOKIT_RADIX_HEAP_H
+#define ALGOKIT_RADIX_HEAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "algokit/item.h"
+
+/*
+ * Monotone radix heap (min-heap keyed by uint64_t priorities)
+ * Invariant: every stored priority is >= the last extracted priority; an item
+ * lives in the bucket indexed by the highest bit where its priority differs
+ * from the last extracted one (bucket 0 holds priorities equal to it).
+ * Complexity: insert O(1), extract_min O(log C) amortized (C = priority range),
+ * peek_min O(bucket size), size/is_empty O(1). No comparator callback is used.
+ * Ownership: heap owns only its bucket arrays; user data freed via destroy callback.
+ */
+
+typedef struct algokit_radix_heap algokit_radix_heap;
+
+algokit_radix_heap *algokit_radix_heap_create(void);
+
+void algokit_radix_heap_destroy(algokit_radix_heap *heap, algokit_item_destroy_fn destroy);
+
+int algokit_radix_heap_insert(algokit_radix_heap *heap, uint64_t priority, Item item);
+
+int algokit_radix_heap_extract_min(algokit_radix_heap *heap, uint64_t *priority, Item *out);
+
+int algokit_radix_heap_peek_min(const algokit_radix_heap *heap, uint64_t *priority, Item *out);
+
+uint64_t algokit_radix_heap_last(const algokit_radix_heap *heap);
+
+size_t algokit_radix_heap_size(const algokit_radix_heap *heap);
+
+int algokit_radix_heap_is_empty(const algokit_radix_heap *heap);
+
+#endif /* ALGOKIT_RADIX_HEAP_H */
@@ -1,11 +1,14 @@
 #ifndef ALGOKIT_RBTREE_H
 #define ALGOKIT_RBTREE_H
 
+#include <stddef.h>
 #include "algokit/item.h"
 
 /*
  * Red-Black Tree (left-leaning)
  * Invariant: red links lean left and no node has two red links.
+ * Each node also stores the size of its subtree, kept up to date by every
+ * rotation, so rank and select queries run in O(log n).
  * Ownership: tree owns only its nodes; user data freed via destroy callback.
  */
 
@@ -23,6 +26,17 @@ int algokit_rbtree_search(const algokit_rbtree *tree, const void *key, Item *out
 
 int algokit_rbtree_remove(algokit_rbtree *tree, const void *key, Item *out);
 
+size_t algokit_rbtree_size(const algokit_rbtree *tree);
+
+/* Writes the item with exactly k smaller keys (k is 0-based); returns 1 if k >= size. */
+int algokit_rbtree_select(const algokit_rbtree *tree, size_t k, Item *out);
+
+/* Writes the number of stored keys < key; key need not be stored. */
+int algokit_rbtree_rank(const algokit_rbtree *tree, const void *key, size_t *out);
+
+/* Writes the number of stored keys with lo <= key <= hi (0 if lo > hi). */
+int algokit_rbtree_count_range(const algokit_rbtree *tree, const void *lo, const void *hi, size_t *out);
+
 int algokit_rbtree_traverse_inorder(const algokit_rbtree *tree, algokit_rbtree_visit_fn visit, void *ctx);
 
 int algokit_rbtree_traverse_preorder(const algokit_rbtree *tree, algokit_rbtree_visit_fn visit, void *ctx);
@@ -0,0 +1,37 @@
+#ifndef ALGOKIT_STRMAP_H
+#define ALGOKIT_STRMAP_H
+
+#include <stddef.h>
+
+/*
+ * String-keyed hash map (byte string -> void *)
+ * Key bytes are copied into an append-only arena owned by the map; each
+ * linear-probing slot holds the key's arena offset, length, full hash and
+ * first 4 bytes, so most mismatches are rejected without reading the arena.
+ * Keys are (pointer, length) pairs and may contain NUL bytes.
+ * Deletes shift the following run back (no tombstones); deleted key bytes
+ * stay in the arena until it is compacted, which happens when it would
+ * otherwise grow while at least half of it is dead.
+ * Capacity is a power of two (at least 8); the map grows past 3/4 load and
+ * shrinks below 1/8.
+ * Complexity: put/get/delete O(1) expected plus O(len) to hash the key.
+ * Ownership: the map owns the key copies; the caller owns val.
+ */
+
+typedef struct algokit_strmap algokit_strmap;
+
+algokit_strmap *algokit_strmap_create(size_t capacity);
+
+void algokit_strmap_destroy(algokit_strmap *map);
+
+int algokit_strmap_put(algokit_strmap *map, const char *key, size_t len, void *val);
+
+int algokit_strmap_get(const algokit_strmap *map, const char *key, size_t len, void **out);
+
+int algokit_strmap_delete(algokit_strmap *map, const char *key, size_t len, void **out);
+
+size_t algokit_strmap_size(const algokit_strmap *map);
+
+size_t algokit_strmap_arena_bytes(const algokit_strmap *map);
+
+#endif /* ALGOKIT_STRMAP_H */
@@ -0,0 +1,40 @@
+#ifndef ALGOKIT_TIMER_WHEEL_H
+#define ALGOKIT_TIMER_WHEEL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "algokit/item.h"
+
+/*
+ * Hierarchical timing wheel
+ * Time is counted in integer ticks. Level 0 has 64 slots of one tick each;
+ * every higher level has 64 slots covering 64 times the span of the level
+ * below. A timer sits in the lowest level whose span covers its remaining
+ * delay and is cascaded down when the clock reaches its slot.
+ * Invariant: a timer scheduled at tick `now` with delay d (d >= 1) fires
+ * during the advance that moves the clock to now + d.
+ * Complexity: schedule/cancel O(1), advance O(ticks + expired + cascaded).
+ * Ownership: wheel owns only its timer nodes (pooled); user data freed via
+ * destroy callback. A timer handle is invalid once it fired or was cancelled.
+ */
+
+typedef struct algokit_timer_wheel algokit_timer_wheel;
+typedef struct algokit_timer_wheel_timer algokit_timer_wheel_timer;
+
+typedef void (*algokit_timer_wheel_expire_fn)(const Item *item, void *ctx);
+
+algokit_timer_wheel *algokit_timer_wheel_create(uint64_t now);
+
+void algokit_timer_wheel_destroy(algokit_timer_wheel *wheel, algokit_item_destroy_fn destroy);
+
+int algokit_timer_wheel_schedule(algokit_timer_wheel *wheel, uint64_t delay, Item item, algokit_timer_wheel_timer **handle);
+
+int algokit_timer_wheel_cancel(algokit_timer_wheel *wheel, algokit_timer_wheel_timer *timer, Item *out);
+
+size_t algokit_timer_wheel_advance(algokit_timer_wheel *wheel, uint64_t ticks, algokit_timer_wheel_expire_fn expire, void *ctx);
+
+uint64_t algokit_timer_wheel_now(const algokit_timer_wheel *wheel);
+
+size_t algokit_timer_wheel_size(const algokit_timer_wheel *wheel);
+
+#endif /* ALGOKIT_TIMER_WHEEL_H */
@@ -0,0 +1,37 @@
+#ifndef ALGOKIT_TOPK_H
+#define ALGOKIT_TOPK_H
+
+#include <stddef.h>
+#include "algokit/item.h"
+
+/*
+ * Bounded top-k collector
+ * Keeps the k items with the largest keys (according to cmp) seen so far,
+ * using an algokit_heap min-heap whose root is the weakest retained item.
+ * Invariant: size <= k; every retained key >= every key dropped so far.
+ * Complexity: offer O(1) when rejected, O(log k) otherwise (one sift);
+ * drain_sorted O(k log k); merge O((k + m) log k) for m items in src.
+ * Ownership: collector owns only its heap; items that fall out are handed
+ * back to the caller. A collector is not thread-safe: use one per thread and
+ * merge them once the producers are done.
+ */
+
+typedef struct algokit_topk algokit_topk;
+
+algokit_topk *algokit_topk_create(size_t k, algokit_key_cmp_fn cmp);
+
+void algokit_topk_destroy(algokit_topk *topk, algokit_item_destroy_fn destroy);
+
+int algokit_topk_offer(algokit_topk *topk, Item item, Item *out);
+
+int algokit_topk_threshold(const algokit_topk *topk, Item *out);
+
+int algokit_topk_drain_sorted(algokit_topk *topk, Item *out, size_t *count);
+
+int algokit_topk_merge(algokit_topk *dst, algokit_topk *src, algokit_item_destroy_fn destroy);
+
+size_t algokit_topk_size(const algokit_topk *topk);
+
+size_t algokit_topk_capacity(const algokit_topk *topk);
+
+#endif /* ALGOKIT_TOPK_H */
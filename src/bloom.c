@@ -0,0 +1,296 @@
+#include "algokit/bloom.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "algokit/key.h"
+
+/*
+ * Split-block layout: one block is 8 words of 32 bits (32 bytes, two blocks
+ * per cache line). A key sets bit (key32 * salt[i]) >> 27 in word i, with
+ * one odd salt per word so the eight bit positions are independent.
+ */
+#define ALGOKIT_BLOOM_WORDS 8
+#define ALGOKIT_BLOOM_LINE 64
+#define ALGOKIT_BLOOM_MAX_BLOCKS ((size_t)1 << 31)
+
+struct algokit_bloom_block {
+    uint32_t words[ALGOKIT_BLOOM_WORDS];
+};
+
+struct algokit_bloom {
+    struct algokit_bloom_block *blocks;
+    void *blocks_raw;
+    size_t block_count;
+};
+
+static const uint32_t algokit_bloom_salt[ALGOKIT_BLOOM_WORDS] = {
+    0x47B6137Bu, 0x44974D91u, 0x8824AD5Bu, 0xA2B7289Du, 0x705495C7u, 0x2DF1424Bu, 0x9EFC4947u, 0x5C6BFB31u,
+};
+
+/* e^-x for x >= 0 without libm: halve x below 1/2, sum the series, square back. */
+static double algokit_bloom_exp_neg(double x) {
+    double term = 1.0;
+    double sum = 1.0;
+    unsigned halvings = 0;
+    unsigned i;
+
+    while (x > 0.5) {
+        x /= 2.0;
+        halvings++;
+    }
+    for (i = 1; i < 20; i++) {
+        term *= -x / (double)i;
+        sum += term;
+    }
+    while (halvings-- > 0) {
+        sum *= sum;
+    }
+    return sum;
+}
+
+/*
+ * Expected false positive rate with load keys per block on average. Block
+ * occupancy is Poisson(load); a block holding j keys has a fraction
+ * 1 - (31/32)^j of each word set, and a query must hit a set bit in all 8.
+ */
+static double algokit_bloom_fp_rate(double load) {
+    double weight;
+    double empty = 1.0;
+    double total = 0.0;
+    unsigned j;
+
+    /* Beyond 256 keys per 256-bit block nearly every bit is set. */
+    if (load > 256.0) {
+        return 1.0;
+    }
+
+    weight = algokit_bloom_exp_neg(load);
+    for (j = 0; j < 1024; j++) {
+        double set = 1.0 - empty;
+        double hit = set * set;
+
+        hit *= hit;
+        hit *= hit;
+        total += weight * hit;
+        if ((double)j > load && weight < 1e-18) {
+            break;
+        }
+        weight *= load / (double)(j + 1);
+        empty *= 31.0 / 32.0;
+    }
+    return total;
+}
+
+/* Smallest block count whose expected rate is at most fp_rate, or 0 if none fits. */
+static size_t algokit_bloom_block_count(size_t expected_items, double fp_rate) {
+    double items = (double)(expected_items ? expected_items : 1);
+    size_t hi = 1;
+    size_t lo;
+
+    while (algokit_bloom_fp_rate(items / (double)hi) > fp_rate) {
+        if (hi >= ALGOKIT_BLOOM_MAX_BLOCKS) {
+            return 0;
+        }
+        hi *= 2;
+    }
+
+    lo = hi / 2 + 1;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (algokit_bloom_fp_rate(items / (double)mid) > fp_rate) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return hi;
+}
+
+/* The high half of the mixed hash picks the block (fastrange), the low half the bits. */
+static const struct algokit_bloom_block *algokit_bloom_locate(const algokit_bloom *bloom, size_t hash,
+                                                             uint32_t *key) {
+    uint64_t mixed = algokit_key_mix64((uint64_t)hash);
+    size_t index = (size_t)(((mixed >> 32) * (uint64_t)bloom->block_count) >> 32);
+
+    *key = (uint32_t)mixed;
+    return &bloom->blocks[index];
+}
+
+algokit_bloom *algokit_bloom_create(size_t expected_items, double fp_rate) {
+    algokit_bloom *bloom;
+    size_t block_count;
+    size_t bytes;
+    void *raw;
+    uintptr_t aligned;
+
+    if (!(fp_rate > 0.0 && fp_rate < 1.0)) {
+        return NULL;
+    }
+
+    block_count = algokit_bloom_block_count(expected_items, fp_rate);
+    if (block_count == 0 || block_count > (SIZE_MAX - ALGOKIT_BLOOM_LINE) / sizeof(struct algokit_bloom_block)) {
+        return NULL;
+    }
+
+    bloom = (algokit_bloom *)malloc(sizeof(*bloom));
+    if (!bloom) {
+        return NULL;
+    }
+
+    /* C99 has no aligned allocation: over-allocate so no block straddles a cache line. */
+    bytes = block_count * sizeof(struct algokit_bloom_block);
+    raw = malloc(bytes + ALGOKIT_BLOOM_LINE - 1);
+    if (!raw) {
+        free(bloom);
+        return NULL;
+    }
+
+    aligned = ((uintptr_t)raw + ALGOKIT_BLOOM_LINE - 1) & ~(uintptr_t)(ALGOKIT_BLOOM_LINE - 1);
+    bloom->blocks = (struct algokit_bloom_block *)aligned;
+    bloom->blocks_raw = raw;
+    bloom->block_count = block_count;
+    memset(bloom->blocks, 0, bytes);
+    return bloom;
+}
+
+algokit_bloom *algokit_bloom_build(const Item *items, size_t count, algokit_key_hash_fn hash, double fp_rate) {
+    algokit_bloom *bloom;
+    size_t i;
+
+    if ((!items && count > 0) || !hash) {
+        return NULL;
+    }
+
+    bloom = algokit_bloom_create(count, fp_rate);
+    if (!bloom) {
+        return NULL;
+    }
+
+    for (i = 0; i < count; i++) {
+        algokit_bloom_add(bloom, hash(items[i].key));
+    }
+    return bloom;
+}
+
+void algokit_bloom_destroy(algokit_bloom *bloom) {
+    if (!bloom) {
+        return;
+    }
+
+    free(bloom->blocks_raw);
+    free(bloom);
+}
+
+int algokit_bloom_add(algokit_bloom *bloom, size_t hash) {
+    struct algokit_bloom_block *block;
+    uint32_t key;
+    unsigned i;
+
+    if (!bloom) {
+        return -1;
+    }
+
+    block = (struct algokit_bloom_block *)algokit_bloom_locate(bloom, hash, &key);
+    for (i = 0; i < ALGOKIT_BLOOM_WORDS; i++) {
+        block->words[i] |= (uint32_t)1 << ((key * algokit_bloom_salt[i]) >> 27);
+    }
+    return 0;
+}
+
+int algokit_bloom_maybe_contains(const algokit_bloom *bloom, size_t hash) {
+    const struct algokit_bloom_block *block;
+    uint32_t key;
+    uint32_t missing = 0;
+    unsigned i;
+
+    if (!bloom) {
+        return 0;
+    }
+
+    /* No early exit: the eight word tests stay branch-free and vectorizable. */
+    block = algokit_bloom_locate(bloom, hash, &key);
+    for (i = 0; i < ALGOKIT_BLOOM_WORDS; i++) {
+        missing |= ~block->words[i] & ((uint32_t)1 << ((key * algokit_bloom_salt[i]) >> 27));
+    }
+    return missing == 0;
+}
+
+void algokit_bloom_clear(algokit_bloom *bloom) {
+    if (!bloom) {
+        return;
+    }
+
+    memset(bloom->blocks, 0, bloom->block_count * sizeof(struct algokit_bloom_block));
+}
+
+size_t algokit_bloom_bytes(const algokit_bloom *bloom) {
+    if (!bloom) {
+        return 0;
+    }
+
+    return bloom->block_count * sizeof(struct algokit_bloom_block);
+}
+
+int algokit_bloom_hash_lp_put(algokit_bloom *bloom, algokit_hash_lp *table, algokit_key_hash_fn hash, Item item) {
+    size_t h;
+    int rc;
+
+    if (!bloom || !table || !hash) {
+        return -1;
+    }
+
+    h = hash(item.key);
+    rc = algokit_hash_lp_put_with_hash(table, item, h);
+    if (rc >= 0) {
+        algokit_bloom_add(bloom, h);
+    }
+    return rc;
+}
+
+int algokit_bloom_hash_lp_get(const algokit_bloom *bloom, const algokit_hash_lp *table, algokit_key_hash_fn hash,
+                              const void *key, Item *out) {
+    size_t h;
+
+    if (!bloom || !table || !hash || !key || !out) {
+        return -1;
+    }
+
+    h = hash(key);
+    if (!algokit_bloom_maybe_contains(bloom, h)) {
+        return 1;
+    }
+    return algokit_hash_lp_get_with_hash(table, key, h, out);
+}
+
+int algokit_bloom_hash_sc_put(algokit_bloom *bloom, algokit_hash_sc *table, algokit_key_hash_fn hash, Item item) {
+    size_t h;
+    int rc;
+
+    if (!bloom || !table || !hash) {
+        return -1;
+    }
+
+    h = hash(item.key);
+    rc = algokit_hash_sc_put_with_hash(table, item, h);
+    if (rc >= 0) {
+        algokit_bloom_add(bloom, h);
+    }
+    return rc;
+}
+
+int algokit_bloom_hash_sc_get(const algokit_bloom *bloom, const algokit_hash_sc *table, algokit_key_hash_fn hash,
+                              const void *key, Item *out) {
+    size_t h;
+
+    if (!bloom || !table || !hash || !key || !out) {
+        return -1;
+    }
+
+    h = hash(key);
+    if (!algokit_bloom_maybe_contains(bloom, h)) {
+        return 1;
+    }
+    return algokit_hash_sc_get_with_hash(table, key, h, out);
+}
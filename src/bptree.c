@@ -0,0 +1,618 @@
+#include "algokit/bptree.h"
+
+#include <stdlib.h>
+
+#include "pool.h"
+
+/*
+ * 15 keys per node: a 64-bit leaf is an 8-byte header, a next link and two
+ * arrays of 15 pointers, an internal node a header, 15 keys and 16
+ * children; both come to exactly 256 bytes.
+ */
+#define ALGOKIT_BPTREE_KEYS 15
+#define ALGOKIT_BPTREE_MIN_KEYS (ALGOKIT_BPTREE_KEYS / 2)
+#define ALGOKIT_BPTREE_LINE 64
+#define ALGOKIT_BPTREE_NODES_PER_SLAB 64
+/* Non-root nodes have at least 8 children, so 32 levels cover any address space. */
+#define ALGOKIT_BPTREE_MAX_DEPTH 32
+
+struct algokit_bptree_node {
+    int leaf;
+    int count;
+};
+
+struct algokit_bptree_leaf {
+    struct algokit_bptree_node hdr;
+    struct algokit_bptree_leaf *next;
+    void *keys[ALGOKIT_BPTREE_KEYS];
+    void *vals[ALGOKIT_BPTREE_KEYS];
+};
+
+struct algokit_bptree_inner {
+    struct algokit_bptree_node hdr;
+    void *keys[ALGOKIT_BPTREE_KEYS];
+    struct algokit_bptree_node *children[ALGOKIT_BPTREE_KEYS + 1];
+};
+
+/* Internal nodes from the root down to the leaf, and the child slot taken in each. */
+struct algokit_bptree_path {
+    struct algokit_bptree_inner *nodes[ALGOKIT_BPTREE_MAX_DEPTH];
+    int slots[ALGOKIT_BPTREE_MAX_DEPTH];
+    int depth;
+};
+
+struct algokit_bptree {
+    struct algokit_bptree_node *root;
+    struct algokit_pool pool;
+    size_t size;
+    algokit_key_cmp_fn cmp;
+};
+
+/* Number of keys in keys[0..count) that are < key. */
+static int algokit_bptree_lower(const algokit_bptree *tree, void *const *keys, int count, const void *key) {
+    int lo = 0;
+    int hi = count;
+
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (tree->cmp(keys[mid], key) < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/* Number of keys in keys[0..count) that are <= key: the child slot to descend into. */
+static int algokit_bptree_upper(const algokit_bptree *tree, void *const *keys, int count, const void *key) {
+    int lo = 0;
+    int hi = count;
+
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (tree->cmp(keys[mid], key) <= 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static struct algokit_bptree_leaf *algokit_bptree_leaf_create(algokit_bptree *tree) {
+    struct algokit_bptree_leaf *leaf = (struct algokit_bptree_leaf *)algokit_pool_alloc(&tree->pool);
+    if (!leaf) {
+        return NULL;
+    }
+    leaf->hdr.leaf = 1;
+    leaf->hdr.count = 0;
+    leaf->next = NULL;
+    return leaf;
+}
+
+/* Walks from the root to the leaf that holds (or would hold) key; path may be NULL. */
+static struct algokit_bptree_leaf *algokit_bptree_descend(const algokit_bptree *tree, const void *key,
+                                                          struct algokit_bptree_path *path) {
+    struct algokit_bptree_node *node = tree->root;
+    int depth = 0;
+
+    while (!node->leaf) {
+        struct algokit_bptree_inner *inner = (struct algokit_bptree_inner *)node;
+        int slot = key ? algokit_bptree_upper(tree, inner->keys, inner->hdr.count, key) : 0;
+        if (path) {
+            path->nodes[depth] = inner;
+            path->slots[depth] = slot;
+        }
+        depth++;
+        node = inner->children[slot];
+    }
+    if (path) {
+        path->depth = depth;
+    }
+    return (struct algokit_bptree_leaf *)node;
+}
+
+static void algokit_bptree_leaf_insert_at(struct algokit_bptree_leaf *leaf, int pos, Item item) {
+    int i;
+
+    for (i = leaf->hdr.count; i > pos; i--) {
+        leaf->keys[i] = leaf->keys[i - 1];
+        leaf->vals[i] = leaf->vals[i - 1];
+    }
+    leaf->keys[pos] = item.key;
+    leaf->vals[pos] = item.val;
+    leaf->hdr.count++;
+}
+
+static void algokit_bptree_leaf_remove_at(struct algokit_bptree_leaf *leaf, int pos) {
+    int i;
+
+    for (i = pos + 1; i < leaf->hdr.count; i++) {
+        leaf->keys[i - 1] = leaf->keys[i];
+        leaf->vals[i - 1] = leaf->vals[i];
+    }
+    leaf->hdr.count--;
+}
+
+/* Inserts key at keys[slot] and child at children[slot + 1]; the node has room. */
+static void algokit_bptree_inner_insert_at(struct algokit_bptree_inner *inner, int slot, void *key,
+                                           struct algokit_bptree_node *child) {
+    int i;
+
+    for (i = inner->hdr.count; i > slot; i--) {
+        inner->keys[i] = inner->keys[i - 1];
+        inner->children[i + 1] = inner->children[i];
+    }
+    inner->keys[slot] = key;
+    inner->children[slot + 1] = child;
+    inner->hdr.count++;
+}
+
+/* Removes keys[slot] and children[slot + 1]. */
+static void algokit_bptree_inner_remove_at(struct algokit_bptree_inner *inner, int slot) {
+    int i;
+
+    for (i = slot + 1; i < inner->hdr.count; i++) {
+        inner->keys[i - 1] = inner->keys[i];
+        inner->children[i] = inner->children[i + 1];
+    }
+    inner->hdr.count--;
+}
+
+/* Splits a full leaf around a new item at pos; right gets the upper half. */
+static void algokit_bptree_leaf_split(struct algokit_bptree_leaf *leaf, struct algokit_bptree_leaf *right, int pos,
+                                      Item item) {
+    void *keys[ALGOKIT_BPTREE_KEYS + 1];
+    void *vals[ALGOKIT_BPTREE_KEYS + 1];
+    int half = (ALGOKIT_BPTREE_KEYS + 1) / 2;
+    int i;
+    int j;
+
+    for (i = 0, j = 0; i <= ALGOKIT_BPTREE_KEYS; i++) {
+        if (i == pos) {
+            keys[i] = item.key;
+            vals[i] = item.val;
+        } else {
+            keys[i] = leaf->keys[j];
+            vals[i] = leaf->vals[j];
+            j++;
+        }
+    }
+
+    for (i = 0; i < half; i++) {
+        leaf->keys[i] = keys[i];
+        leaf->vals[i] = vals[i];
+    }
+    for (i = half; i <= ALGOKIT_BPTREE_KEYS; i++) {
+        right->keys[i - half] = keys[i];
+        right->vals[i - half] = vals[i];
+    }
+    leaf->hdr.count = half;
+    right->hdr.count = ALGOKIT_BPTREE_KEYS + 1 - half;
+    right->next = leaf->next;
+    leaf->next = right;
+}
+
+/*
+ * Splits a full internal node that receives (key, child) at slot. The middle
+ * key moves up: it is returned and is in neither half.
+ */
+static void *algokit_bptree_inner_split(struct algokit_bptree_inner *inner, struct algokit_bptree_inner *right,
+                                        int slot, void *key, struct algokit_bptree_node *child) {
+    void *keys[ALGOKIT_BPTREE_KEYS + 1];
+    struct algokit_bptree_node *children[ALGOKIT_BPTREE_KEYS + 2];
+    int half = ALGOKIT_BPTREE_KEYS / 2;
+    int i;
+    int j;
+
+    children[0] = inner->children[0];
+    for (i = 0, j = 0; i <= ALGOKIT_BPTREE_KEYS; i++) {
+        if (i == slot) {
+            keys[i] = key;
+            children[i + 1] = child;
+        } else {
+            keys[i] = inner->keys[j];
+            children[i + 1] = inner->children[j + 1];
+            j++;
+        }
+    }
+
+    for (i = 0; i < half; i++) {
+        inner->keys[i] = keys[i];
+        inner->children[i] = children[i];
+    }
+    inner->children[half] = children[half];
+    inner->hdr.count = half;
+
+    right->hdr.leaf = 0;
+    right->hdr.count = ALGOKIT_BPTREE_KEYS - half;
+    for (i = half + 1; i <= ALGOKIT_BPTREE_KEYS; i++) {
+        right->keys[i - half - 1] = keys[i];
+        right->children[i - half - 1] = children[i];
+    }
+    right->children[ALGOKIT_BPTREE_KEYS - half] = children[ALGOKIT_BPTREE_KEYS + 1];
+    return keys[half];
+}
+
+/* Merges child slot + 1 of parent into child slot and drops the key between them. */
+static void algokit_bptree_merge(algokit_bptree *tree, struct algokit_bptree_inner *parent, int slot) {
+    struct algokit_bptree_node *left = parent->children[slot];
+    struct algokit_bptree_node *right = parent->children[slot + 1];
+    int i;
+
+    if (left->leaf) {
+        struct algokit_bptree_leaf *l = (struct algokit_bptree_leaf *)left;
+        struct algokit_bptree_leaf *r = (struct algokit_bptree_leaf *)right;
+        for (i = 0; i < r->hdr.count; i++) {
+            l->keys[l->hdr.count + i] = r->keys[i];
+            l->vals[l->hdr.count + i] = r->vals[i];
+        }
+        l->hdr.count += r->hdr.count;
+        l->next = r->next;
+    } else {
+        struct algokit_bptree_inner *l = (struct algokit_bptree_inner *)left;
+        struct algokit_bptree_inner *r = (struct algokit_bptree_inner *)right;
+        l->keys[l->hdr.count] = parent->keys[slot];
+        for (i = 0; i < r->hdr.count; i++) {
+            l->keys[l->hdr.count + 1 + i] = r->keys[i];
+            l->children[l->hdr.count + 1 + i] = r->children[i];
+        }
+        l->children[l->hdr.count + 1 + r->hdr.count] = r->children[r->hdr.count];
+        l->hdr.count += 1 + r->hdr.count;
+    }
+
+    algokit_bptree_inner_remove_at(parent, slot);
+    algokit_pool_free(&tree->pool, right);
+}
+
+/* Moves one entry from the left sibling (child slot - 1) into child slot. */
+static void algokit_bptree_borrow_left(struct algokit_bptree_inner *parent, int slot) {
+    struct algokit_bptree_node *node = parent->children[slot];
+    struct algokit_bptree_node *left = parent->children[slot - 1];
+    int i;
+
+    if (node->leaf) {
+        struct algokit_bptree_leaf *n = (struct algokit_bptree_leaf *)node;
+        struct algokit_bptree_leaf *l = (struct algokit_bptree_leaf *)left;
+        Item item;
+        item.key = l->keys[l->hdr.count - 1];
+        item.val = l->vals[l->hdr.count - 1];
+        l->hdr.count--;
+        algokit_bptree_leaf_insert_at(n, 0, item);
+        parent->keys[slot - 1] = n->keys[0];
+    } else {
+        struct algokit_bptree_inner *n = (struct algokit_bptree_inner *)node;
+        struct algokit_bptree_inner *l = (struct algokit_bptree_inner *)left;
+        for (i = n->hdr.count; i > 0; i--) {
+            n->keys[i] = n->keys[i - 1];
+            n->children[i + 1] = n->children[i];
+        }
+        n->children[1] = n->children[0];
+        n->keys[0] = parent->keys[slot - 1];
+        n->children[0] = l->children[l->hdr.count];
+        n->hdr.count++;
+        parent->keys[slot - 1] = l->keys[l->hdr.count - 1];
+        l->hdr.count--;
+    }
+}
+
+/* Moves one entry from the right sibling (child slot + 1) into child slot. */
+static void algokit_bptree_borrow_right(struct algokit_bptree_inner *parent, int slot) {
+    struct algokit_bptree_node *node = parent->children[slot];
+    struct algokit_bptree_node *right = parent->children[slot + 1];
+    int i;
+
+    if (node->leaf) {
+        struct algokit_bptree_leaf *n = (struct algokit_bptree_leaf *)node;
+        struct algokit_bptree_leaf *r = (struct algokit_bptree_leaf *)right;
+        n->keys[n->hdr.count] = r->keys[0];
+        n->vals[n->hdr.count] = r->vals[0];
+        n->hdr.count++;
+        algokit_bptree_leaf_remove_at(r, 0);
+        parent->keys[slot] = r->keys[0];
+    } else {
+        struct algokit_bptree_inner *n = (struct algokit_bptree_inner *)node;
+        struct algokit_bptree_inner *r = (struct algokit_bptree_inner *)right;
+        n->keys[n->hdr.count] = parent->keys[slot];
+        n->children[n->hdr.count + 1] = r->children[0];
+        n->hdr.count++;
+        parent->keys[slot] = r->keys[0];
+        for (i = 1; i < r->hdr.count; i++) {
+            r->keys[i - 1] = r->keys[i];
+        }
+        for (i = 1; i <= r->hdr.count; i++) {
+            r->children[i - 1] = r->children[i];
+        }
+        r->hdr.count--;
+    }
+}
+
+/* Restores the minimum fill from the leaf upwards after a removal. */
+static void algokit_bptree_rebalance(algokit_bptree *tree, const struct algokit_bptree_path *path,
+                                     struct algokit_bptree_node *node) {
+    int level = path->depth;
+
+    while (level > 0 && node->count < ALGOKIT_BPTREE_MIN_KEYS) {
+        struct algokit_bptree_inner *parent = path->nodes[level - 1];
+        int slot = path->slots[level - 1];
+
+        if (slot > 0 && parent->children[slot - 1]->count > ALGOKIT_BPTREE_MIN_KEYS) {
+            algokit_bptree_borrow_left(parent, slot);
+        } else if (slot < parent->hdr.count && parent->children[slot + 1]->count > ALGOKIT_BPTREE_MIN_KEYS) {
+            algokit_bptree_borrow_right(parent, slot);
+        } else if (slot > 0) {
+            algokit_bptree_merge(tree, parent, slot - 1);
+        } else {
+            algokit_bptree_merge(tree, parent, slot);
+        }
+        node = &parent->hdr;
+        level--;
+    }
+
+    /* The root shrinks by one level when it has a single child left, and goes away when empty. */
+    node = tree->root;
+    if (node->count == 0) {
+        tree->root = node->leaf ? NULL : ((struct algokit_bptree_inner *)node)->children[0];
+        algokit_pool_free(&tree->pool, node);
+    }
+}
+
+static int algokit_bptree_visit_leaves(const algokit_bptree *tree, const struct algokit_bptree_leaf *leaf, int pos,
+                                       const void *hi, algokit_bptree_visit_fn visit, void *ctx) {
+    Item item;
+
+    while (leaf) {
+        for (; pos < leaf->hdr.count; pos++) {
+            if (hi && tree->cmp(leaf->keys[pos], hi) > 0) {
+                return 0;
+            }
+            item.key = leaf->keys[pos];
+            item.val = leaf->vals[pos];
+            visit(&item, ctx);
+        }
+        leaf = leaf->next;
+        pos = 0;
+    }
+    return 0;
+}
+
+algokit_bptree *algokit_bptree_create(algokit_key_cmp_fn cmp) {
+    algokit_bptree *tree;
+    size_t node_size = sizeof(struct algokit_bptree_leaf);
+
+    if (!cmp) {
+        return NULL;
+    }
+
+    tree = (algokit_bptree *)malloc(sizeof(*tree));
+    if (!tree) {
+        return NULL;
+    }
+
+    if (sizeof(struct algokit_bptree_inner) > node_size) {
+        node_size = sizeof(struct algokit_bptree_inner);
+    }
+    algokit_pool_init_aligned(&tree->pool, node_size, ALGOKIT_BPTREE_NODES_PER_SLAB, ALGOKIT_BPTREE_LINE);
+    tree->root = NULL;
+    tree->size = 0;
+    tree->cmp = cmp;
+    return tree;
+}
+
+void algokit_bptree_destroy(algokit_bptree *tree, algokit_item_destroy_fn destroy) {
+    if (!tree) {
+        return;
+    }
+
+    /* The leaf chain reaches every item without recursion; nodes go back with their slabs. */
+    if (destroy && tree->root) {
+        const struct algokit_bptree_leaf *leaf = algokit_bptree_descend(tree, NULL, NULL);
+        while (leaf) {
+            int i;
+            for (i = 0; i < leaf->hdr.count; i++) {
+                destroy(leaf->keys[i], leaf->vals[i]);
+            }
+            leaf = leaf->next;
+        }
+    }
+
+    algokit_pool_release(&tree->pool);
+    free(tree);
+}
+
+int algokit_bptree_insert(algokit_bptree *tree, Item item) {
+    struct algokit_bptree_path path;
+    struct algokit_bptree_leaf *leaf;
+    struct algokit_bptree_leaf *right;
+    struct algokit_bptree_node *spare[ALGOKIT_BPTREE_MAX_DEPTH + 1];
+    struct algokit_bptree_node *child;
+    void *key;
+    int needed;
+    int level;
+    int pos;
+    int i;
+
+    if (!tree || !item.key) {
+        return -1;
+    }
+
+    if (!tree->root) {
+        leaf = algokit_bptree_leaf_create(tree);
+        if (!leaf) {
+            return -1;
+        }
+        tree->root = &leaf->hdr;
+    }
+
+    leaf = algokit_bptree_descend(tree, item.key, &path);
+    pos = algokit_bptree_lower(tree, leaf->keys, leaf->hdr.count, item.key);
+    if (pos < leaf->hdr.count && tree->cmp(leaf->keys[pos], item.key) == 0) {
+        return 1;
+    }
+
+    if (leaf->hdr.count < ALGOKIT_BPTREE_KEYS) {
+        algokit_bptree_leaf_insert_at(leaf, pos, item);
+        tree->size++;
+        return 0;
+    }
+
+    /* Allocate every node the split can cascade into first, so a failure leaves the tree untouched. */
+    needed = 1;
+    level = path.depth;
+    while (level > 0 && path.nodes[level - 1]->hdr.count == ALGOKIT_BPTREE_KEYS) {
+        needed++;
+        level--;
+    }
+    if (level == 0) {
+        needed++;
+    }
+    for (i = 0; i < needed; i++) {
+        spare[i] = (struct algokit_bptree_node *)algokit_pool_alloc(&tree->pool);
+        if (!spare[i]) {
+            while (i > 0) {
+                algokit_pool_free(&tree->pool, spare[--i]);
+            }
+            return -1;
+        }
+    }
+
+    right = (struct algokit_bptree_leaf *)spare[--needed];
+    right->hdr.leaf = 1;
+    algokit_bptree_leaf_split(leaf, right, pos, item);
+    key = right->keys[0];
+    child = &right->hdr;
+
+    for (level = path.depth; level > 0; level--) {
+        struct algokit_bptree_inner *parent = path.nodes[level - 1];
+        int slot = path.slots[level - 1];
+        struct algokit_bptree_inner *sibling;
+
+        if (parent->hdr.count < ALGOKIT_BPTREE_KEYS) {
+            algokit_bptree_inner_insert_at(parent, slot, key, child);
+            break;
+        }
+        sibling = (struct algokit_bptree_inner *)spare[--needed];
+        key = algokit_bptree_inner_split(parent, sibling, slot, key, child);
+        child = &sibling->hdr;
+    }
+
+    if (level == 0) {
+        struct algokit_bptree_inner *root = (struct algokit_bptree_inner *)spare[--needed];
+        root->hdr.leaf = 0;
+        root->hdr.count = 1;
+        root->keys[0] = key;
+        root->children[0] = tree->root;
+        root->children[1] = child;
+        tree->root = &root->hdr;
+    }
+
+    tree->size++;
+    return 0;
+}
+
+int algokit_bptree_search(const algokit_bptree *tree, const void *key, Item *out) {
+    const struct algokit_bptree_leaf *leaf;
+    int pos;
+
+    if (!tree || !key || !out) {
+        return -1;
+    }
+
+    if (!tree->root) {
+        return 1;
+    }
+
+    leaf = algokit_bptree_descend(tree, key, NULL);
+    pos = algokit_bptree_lower(tree, leaf->keys, leaf->hdr.count, key);
+    if (pos == leaf->hdr.count || tree->cmp(leaf->keys[pos], key) != 0) {
+        return 1;
+    }
+
+    out->key = leaf->keys[pos];
+    out->val = leaf->vals[pos];
+    return 0;
+}
+
+int algokit_bptree_remove(algokit_bptree *tree, const void *key, Item *out) {
+    struct algokit_bptree_path path;
+    struct algokit_bptree_leaf *leaf;
+    int pos;
+    int i;
+
+    if (!tree || !key || !out) {
+        return -1;
+    }
+
+    if (!tree->root) {
+        return 1;
+    }
+
+    leaf = algokit_bptree_descend(tree, key, &path);
+    pos = algokit_bptree_lower(tree, leaf->keys, leaf->hdr.count, key);
+    if (pos == leaf->hdr.count || tree->cmp(leaf->keys[pos], key) != 0) {
+        return 1;
+    }
+
+    out->key = leaf->keys[pos];
+    out->val = leaf->vals[pos];
+    algokit_bptree_leaf_remove_at(leaf, pos);
+    tree->size--;
+
+    /*
+     * A leaf's first key may also be a separator in one ancestor. The caller
+     * may free the removed key, so that separator must now point at the new
+     * first key (a non-root leaf never empties here: it held more than 7).
+     */
+    if (pos == 0 && leaf->hdr.count > 0) {
+        for (i = 0; i < path.depth; i++) {
+            if (path.slots[i] > 0 && path.nodes[i]->keys[path.slots[i] - 1] == out->key) {
+                path.nodes[i]->keys[path.slots[i] - 1] = leaf->keys[0];
+                break;
+            }
+        }
+    }
+
+    algokit_bptree_rebalance(tree, &path, &leaf->hdr);
+    return 0;
+}
+
+size_t algokit_bptree_size(const algokit_bptree *tree) {
+    if (!tree) {
+        return 0;
+    }
+
+    return tree->size;
+}
+
+int algokit_bptree_traverse_inorder(const algokit_bptree *tree, algokit_bptree_visit_fn visit, void *ctx) {
+    if (!tree || !visit) {
+        return -1;
+    }
+
+    if (!tree->root) {
+        return 0;
+    }
+
+    return algokit_bptree_visit_leaves(tree, algokit_bptree_descend(tree, NULL, NULL), 0, NULL, visit, ctx);
+}
+
+int algokit_bptree_range(const algokit_bptree *tree, const void *lo, const void *hi, algokit_bptree_visit_fn visit,
+                         void *ctx) {
+    const struct algokit_bptree_leaf *leaf;
+    int pos = 0;
+
+    if (!tree || !visit) {
+        return -1;
+    }
+
+    if (!tree->root) {
+        return 0;
+    }
+
+    leaf = algokit_bptree_descend(tree, lo, NULL);
+    if (lo) {
+        pos = algokit_bptree_lower(tree, leaf->keys, leaf->hdr.count, lo);
+    }
+    return algokit_bptree_visit_leaves(tree, leaf, pos, hi, visit, ctx);
+}
@@ -2,6 +2,11 @@
 
 #include <stdlib.h>
 
+#include "pool.h"
+
+/* Nodes carved per slab: 256 nodes of 32 bytes make an 8 KiB slab on 64-bit targets. */
+#define ALGOKIT_BST_NODES_PER_SLAB 256
+
 struct algokit_bst_node {
     Item item;
     struct algokit_bst_node *left;
@@ -10,6 +15,7 @@ struct algokit_bst_node {
 
 struct algokit_bst {
     struct algokit_bst_node *root;
+    struct algokit_pool pool;
     algokit_key_cmp_fn cmp;
 };
 
@@ -17,8 +23,8 @@ static int algokit_bst_cmp(const algokit_bst *tree, const void *a, const void *b
     return tree->cmp(a, b);
 }
 
-static struct algokit_bst_node *algokit_bst_node_create(Item item) {
-    struct algokit_bst_node *node = (struct algokit_bst_node *)malloc(sizeof(*node));
+static struct algokit_bst_node *algokit_bst_node_create(algokit_bst *tree, Item item) {
+    struct algokit_bst_node *node = (struct algokit_bst_node *)algokit_pool_alloc(&tree->pool);
     if (!node) {
         return NULL;
     }
@@ -28,23 +34,21 @@ static struct algokit_bst_node *algokit_bst_node_create(Item item) {
     return node;
 }
 
-static void algokit_bst_node_destroy(struct algokit_bst_node *node, algokit_item_destroy_fn destroy) {
+/* Only walked for a destroy callback: the nodes themselves go back with their slabs. */
+static void algokit_bst_node_destroy(const struct algokit_bst_node *node, algokit_item_destroy_fn destroy) {
     if (!node) {
         return;
     }
     algokit_bst_node_destroy(node->left, destroy);
     algokit_bst_node_destroy(node->right, destroy);
-    if (destroy) {
-        destroy(node->item.key, node->item.val);
-    }
-    free(node);
+    destroy(node->item.key, node->item.val);
 }
 
 static int algokit_bst_insert_node(struct algokit_bst *tree, struct algokit_bst_node **node, Item item) {
     int cmp;
 
     if (!*node) {
-        *node = algokit_bst_node_create(item);
+        *node = algokit_bst_node_create(tree, item);
         return *node ? 0 : -1;
     }
 
@@ -103,12 +107,12 @@ static struct algokit_bst_node *algokit_bst_remove_node(struct algokit_bst *tree
 
     if (!node->left) {
         struct algokit_bst_node *right = node->right;
-        free(node);
+        algokit_pool_free(&tree->pool, node);
         return right;
     }
     if (!node->right) {
         struct algokit_bst_node *left = node->left;
-        free(node);
+        algokit_pool_free(&tree->pool, node);
         return left;
     }
 
@@ -159,6 +163,7 @@ algokit_bst *algokit_bst_create(algokit_key_cmp_fn cmp) {
     }
 
     tree->root = NULL;
+    algokit_pool_init(&tree->pool, sizeof(struct algokit_bst_node), ALGOKIT_BST_NODES_PER_SLAB);
     tree->cmp = cmp;
     return tree;
 }
@@ -168,7 +173,10 @@ void algokit_bst_destroy(algokit_bst *tree, algokit_item_destroy_fn destroy) {
         return;
     }
 
-    algokit_bst_node_destroy(tree->root, destroy);
+    if (destroy) {
+        algokit_bst_node_destroy(tree->root, destroy);
+    }
+    algokit_pool_release(&tree->pool);
     free(tree);
 }
 
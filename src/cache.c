@@ -0,0 +1,296 @@
+#include "algokit/cache.h"
+
+#include <stdlib.h>
+
+#include "algokit/hash.h"
+
+#define ALGOKIT_CACHE_NONE ((size_t)-1)
+
+/*
+ * Entries live in one array allocated at create and never move, so the
+ * index can store a pointer to the entry as its value. prev/next link the
+ * LRU recency list; next also chains unused entries into the free list.
+ */
+struct algokit_cache_entry {
+    Item item;
+    size_t prev;
+    size_t next;
+    unsigned char referenced;
+    unsigned char used;
+};
+
+struct algokit_cache {
+    struct algokit_cache_entry *entries;
+    algokit_hash_sc *index;
+    size_t capacity;
+    size_t size;
+    size_t head;
+    size_t tail;
+    size_t free_head;
+    size_t hand;
+    int policy;
+    algokit_key_hash_fn hash;
+    algokit_item_destroy_fn evict;
+    algokit_cache_stats stats;
+};
+
+static void algokit_cache_unlink(algokit_cache *cache, size_t i) {
+    struct algokit_cache_entry *entry = &cache->entries[i];
+
+    if (entry->prev != ALGOKIT_CACHE_NONE) {
+        cache->entries[entry->prev].next = entry->next;
+    } else {
+        cache->head = entry->next;
+    }
+    if (entry->next != ALGOKIT_CACHE_NONE) {
+        cache->entries[entry->next].prev = entry->prev;
+    } else {
+        cache->tail = entry->prev;
+    }
+}
+
+static void algokit_cache_push_front(algokit_cache *cache, size_t i) {
+    struct algokit_cache_entry *entry = &cache->entries[i];
+
+    entry->prev = ALGOKIT_CACHE_NONE;
+    entry->next = cache->head;
+    if (cache->head != ALGOKIT_CACHE_NONE) {
+        cache->entries[cache->head].prev = i;
+    } else {
+        cache->tail = i;
+    }
+    cache->head = i;
+}
+
+/* Returns entry i to the free list; the caller has already removed it from the index. */
+static void algokit_cache_release(algokit_cache *cache, size_t i) {
+    if (cache->policy == ALGOKIT_CACHE_LRU) {
+        algokit_cache_unlink(cache, i);
+    }
+    cache->entries[i].used = 0;
+    cache->entries[i].next = cache->free_head;
+    cache->free_head = i;
+    cache->size--;
+}
+
+/* Only called on a full cache, so every entry the CLOCK hand passes is in use. */
+static size_t algokit_cache_victim(algokit_cache *cache) {
+    size_t victim;
+
+    if (cache->policy == ALGOKIT_CACHE_LRU) {
+        return cache->tail;
+    }
+
+    while (cache->entries[cache->hand].referenced) {
+        cache->entries[cache->hand].referenced = 0;
+        if (++cache->hand == cache->capacity) {
+            cache->hand = 0;
+        }
+    }
+    victim = cache->hand;
+    if (++cache->hand == cache->capacity) {
+        cache->hand = 0;
+    }
+    return victim;
+}
+
+static void algokit_cache_evict_one(algokit_cache *cache) {
+    size_t victim = algokit_cache_victim(cache);
+    Item item = cache->entries[victim].item;
+    Item removed;
+
+    algokit_hash_sc_delete(cache->index, item.key, &removed);
+    algokit_cache_release(cache, victim);
+    cache->stats.evictions++;
+    if (cache->evict) {
+        cache->evict(item.key, item.val);
+    }
+}
+
+algokit_cache *algokit_cache_create(size_t capacity, int policy, algokit_key_hash_fn hash, algokit_key_cmp_fn cmp,
+                                    algokit_item_destroy_fn evict) {
+    algokit_cache *cache;
+    size_t i;
+
+    if (capacity == 0 || !hash || !cmp || (policy != ALGOKIT_CACHE_LRU && policy != ALGOKIT_CACHE_CLOCK)) {
+        return NULL;
+    }
+
+    cache = (algokit_cache *)malloc(sizeof(*cache));
+    if (!cache) {
+        return NULL;
+    }
+
+    cache->entries = (struct algokit_cache_entry *)malloc(capacity * sizeof(*cache->entries));
+    cache->index = algokit_hash_sc_create(capacity, hash, cmp);
+    if (!cache->entries || !cache->index) {
+        free(cache->entries);
+        algokit_hash_sc_destroy(cache->index, NULL);
+        free(cache);
+        return NULL;
+    }
+
+    for (i = 0; i < capacity; i++) {
+        cache->entries[i].used = 0;
+        cache->entries[i].referenced = 0;
+        cache->entries[i].next = i + 1 < capacity ? i + 1 : ALGOKIT_CACHE_NONE;
+    }
+
+    cache->capacity = capacity;
+    cache->size = 0;
+    cache->head = ALGOKIT_CACHE_NONE;
+    cache->tail = ALGOKIT_CACHE_NONE;
+    cache->free_head = 0;
+    cache->hand = 0;
+    cache->policy = policy;
+    cache->hash = hash;
+    cache->evict = evict;
+    cache->stats.hits = 0;
+    cache->stats.misses = 0;
+    cache->stats.inserts = 0;
+    cache->stats.evictions = 0;
+    return cache;
+}
+
+void algokit_cache_destroy(algokit_cache *cache, algokit_item_destroy_fn destroy) {
+    size_t i;
+
+    if (!cache) {
+        return;
+    }
+
+    for (i = 0; destroy && i < cache->capacity; i++) {
+        if (cache->entries[i].used) {
+            destroy(cache->entries[i].item.key, cache->entries[i].item.val);
+        }
+    }
+
+    algokit_hash_sc_destroy(cache->index, NULL);
+    free(cache->entries);
+    free(cache);
+}
+
+int algokit_cache_put(algokit_cache *cache, Item item) {
+    Item found;
+    Item link;
+    size_t hash;
+    size_t slot;
+    int rc;
+
+    if (!cache || !item.key) {
+        return -1;
+    }
+
+    /* Hash once for both the duplicate check and the insert. */
+    hash = cache->hash(item.key);
+    rc = algokit_hash_sc_get_with_hash(cache->index, item.key, hash, &found);
+    if (rc <= 0) {
+        return rc == 0 ? 1 : rc;
+    }
+
+    if (cache->size == cache->capacity) {
+        algokit_cache_evict_one(cache);
+    }
+
+    slot = cache->free_head;
+    cache->free_head = cache->entries[slot].next;
+    cache->entries[slot].item = item;
+    cache->entries[slot].referenced = 0;
+    cache->entries[slot].used = 1;
+
+    link.key = item.key;
+    link.val = &cache->entries[slot];
+    if (algokit_hash_sc_put_with_hash(cache->index, link, hash) != 0) {
+        cache->entries[slot].used = 0;
+        cache->entries[slot].next = cache->free_head;
+        cache->free_head = slot;
+        return -1;
+    }
+
+    if (cache->policy == ALGOKIT_CACHE_LRU) {
+        algokit_cache_push_front(cache, slot);
+    }
+    cache->size++;
+    cache->stats.inserts++;
+    return 0;
+}
+
+int algokit_cache_get(algokit_cache *cache, const void *key, Item *out) {
+    struct algokit_cache_entry *entry;
+    Item link;
+    size_t i;
+    int rc;
+
+    if (!cache || !key || !out) {
+        return -1;
+    }
+
+    rc = algokit_hash_sc_get(cache->index, key, &link);
+    if (rc != 0) {
+        if (rc == 1) {
+            cache->stats.misses++;
+        }
+        return rc;
+    }
+
+    entry = (struct algokit_cache_entry *)link.val;
+    i = (size_t)(entry - cache->entries);
+    if (cache->policy == ALGOKIT_CACHE_LRU) {
+        if (cache->head != i) {
+            algokit_cache_unlink(cache, i);
+            algokit_cache_push_front(cache, i);
+        }
+    } else if (!entry->referenced) {
+        /* Test before writing so repeated hits leave the cache line clean. */
+        entry->referenced = 1;
+    }
+
+    cache->stats.hits++;
+    *out = entry->item;
+    return 0;
+}
+
+int algokit_cache_delete(algokit_cache *cache, const void *key, Item *out) {
+    struct algokit_cache_entry *entry;
+    Item link;
+    int rc;
+
+    if (!cache || !key || !out) {
+        return -1;
+    }
+
+    rc = algokit_hash_sc_delete(cache->index, key, &link);
+    if (rc != 0) {
+        return rc;
+    }
+
+    entry = (struct algokit_cache_entry *)link.val;
+    *out = entry->item;
+    algokit_cache_release(cache, (size_t)(entry - cache->entries));
+    return 0;
+}
+
+size_t algokit_cache_size(const algokit_cache *cache) {
+    if (!cache) {
+        return 0;
+    }
+
+    return cache->size;
+}
+
+size_t algokit_cache_capacity(const algokit_cache *cache) {
+    if (!cache) {
+        return 0;
+    }
+
+    return cache->capacity;
+}
+
+int algokit_cache_get_stats(const algokit_cache *cache, algokit_cache_stats *out) {
+    if (!cache || !out) {
+        return -1;
+    }
+
+    *out = cache->stats;
+    return 0;
+}
@@ -1,5 +1,6 @@
 #include "algokit/digraph.h"
 
+#include <stdint.h>
 #include <stdlib.h>
 
 struct algokit_digraph_edge {
@@ -14,6 +15,7 @@ struct algokit_digraph_vertex {
 
 struct algokit_digraph_map_entry {
     void *key;
+    size_t hash; /* vertex key hash, kept for rehashing */
     size_t index;
     int state;
 };
@@ -22,6 +24,7 @@ struct algokit_digraph_map {
     struct algokit_digraph_map_entry *entries;
     size_t capacity;
     size_t size;
+    unsigned shift;
     algokit_key_hash_fn hash;
     algokit_key_cmp_fn cmp;
 };
@@ -33,29 +36,42 @@ struct algokit_digraph {
     struct algokit_digraph_map map;
 };
 
-static size_t algokit_digraph_map_index(const struct algokit_digraph_map *map, const void *key) {
-    return map->hash(key) % map->capacity;
+/* Capacities are powers of two (at least 8 slots); returns log2 of the rounded capacity. */
+static unsigned algokit_digraph_map_bits(size_t capacity) {
+    unsigned bits = 3;
+
+    while (((size_t)1 << bits) < capacity) {
+        bits++;
+    }
+    return bits;
+}
+
+/* Fibonacci hashing: multiply by 2^64/phi and keep the top bits as the slot. */
+static size_t algokit_digraph_map_index(const struct algokit_digraph_map *map, size_t hash) {
+    return (size_t)(((uint64_t)hash * UINT64_C(0x9E3779B97F4A7C15)) >> map->shift);
 }
 
 static int algokit_digraph_map_resize(struct algokit_digraph_map *map, size_t new_capacity) {
     size_t i;
     struct algokit_digraph_map_entry *old_entries = map->entries;
     size_t old_capacity = map->capacity;
+    unsigned bits = algokit_digraph_map_bits(new_capacity);
 
-    map->entries = (struct algokit_digraph_map_entry *)calloc(new_capacity, sizeof(*map->entries));
+    map->entries = (struct algokit_digraph_map_entry *)calloc((size_t)1 << bits, sizeof(*map->entries));
     if (!map->entries) {
         map->entries = old_entries;
         return -1;
     }
 
-    map->capacity = new_capacity;
+    map->capacity = (size_t)1 << bits;
+    map->shift = 64u - bits;
     map->size = 0;
 
     for (i = 0; i < old_capacity; i++) {
         if (old_entries[i].state == 1) {
-            size_t idx = algokit_digraph_map_index(map, old_entries[i].key);
+            size_t idx = algokit_digraph_map_index(map, old_entries[i].hash);
             while (map->entries[idx].state == 1) {
-                idx = (idx + 1) % map->capacity;
+                idx = (idx + 1) & (map->capacity - 1);
             }
             map->entries[idx] = old_entries[i];
             map->entries[idx].state = 1;
@@ -68,25 +84,29 @@ static int algokit_digraph_map_resize(struct algokit_digraph_map *map, size_t ne
 }
 
 static int algokit_digraph_map_get(const struct algokit_digraph_map *map, const void *key, size_t *out_index) {
+    size_t hash;
     size_t idx;
 
     if (!map || !key || !out_index) {
         return -1;
     }
 
-    idx = algokit_digraph_map_index(map, key);
+    hash = map->hash(key);
+    idx = algokit_digraph_map_index(map, hash);
     while (map->entries[idx].state != 0) {
-        if (map->entries[idx].state == 1 && map->cmp(map->entries[idx].key, key) == 0) {
+        if (map->entries[idx].state == 1 && map->entries[idx].hash == hash &&
+            map->cmp(map->entries[idx].key, key) == 0) {
             *out_index = map->entries[idx].index;
             return 0;
         }
-        idx = (idx + 1) % map->capacity;
+        idx = (idx + 1) & (map->capacity - 1);
     }
 
     return 1;
 }
 
 static int algokit_digraph_map_put(struct algokit_digraph_map *map, void *key, size_t index) {
+    size_t hash;
     size_t idx;
 
     if (!map) {
@@ -99,15 +119,17 @@ static int algokit_digraph_map_put(struct algokit_digraph_map *map, void *key, s
         }
     }
 
-    idx = algokit_digraph_map_index(map, key);
+    hash = map->hash(key);
+    idx = algokit_digraph_map_index(map, hash);
     while (map->entries[idx].state == 1) {
-        if (map->cmp(map->entries[idx].key, key) == 0) {
+        if (map->entries[idx].hash == hash && map->cmp(map->entries[idx].key, key) == 0) {
             return 1;
         }
-        idx = (idx + 1) % map->capacity;
+        idx = (idx + 1) & (map->capacity - 1);
     }
 
     map->entries[idx].key = key;
+    map->entries[idx].hash = hash;
     map->entries[idx].index = index;
     map->entries[idx].state = 1;
     map->size++;
@@ -124,6 +146,7 @@ static void algokit_digraph_free_edges(struct algokit_digraph_edge *edge) {
 
 algokit_digraph *algokit_digraph_create(size_t capacity, algokit_key_hash_fn hash, algokit_key_cmp_fn cmp) {
     algokit_digraph *graph;
+    unsigned bits;
 
     if (!hash || !cmp || capacity == 0) {
         return NULL;
@@ -143,14 +166,16 @@ algokit_digraph *algokit_digraph_create(size_t capacity, algokit_key_hash_fn has
     graph->size = 0;
     graph->capacity = capacity;
 
-    graph->map.entries = (struct algokit_digraph_map_entry *)calloc(capacity, sizeof(*graph->map.entries));
+    bits = algokit_digraph_map_bits(capacity);
+    graph->map.entries = (struct algokit_digraph_map_entry *)calloc((size_t)1 << bits, sizeof(*graph->map.entries));
     if (!graph->map.entries) {
         free(graph->vertices);
         free(graph);
         return NULL;
     }
 
-    graph->map.capacity = capacity;
+    graph->map.capacity = (size_t)1 << bits;
+    graph->map.shift = 64u - bits;
     graph->map.size = 0;
     graph->map.hash = hash;
     graph->map.cmp = cmp;
@@ -2,6 +2,7 @@
 #include "algokit/uf.h"
 
 #include <float.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 struct algokit_graph_edge {
@@ -17,6 +18,7 @@ struct algokit_graph_vertex {
 
 struct algokit_graph_map_entry {
     void *key;
+    size_t hash; /* hash of key, checked before cmp */
     size_t index;
     int state;
 };
@@ -25,6 +27,7 @@ struct algokit_graph_map {
     struct algokit_graph_map_entry *entries;
     size_t capacity;
     size_t size;
+    unsigned shift;
     algokit_key_hash_fn hash;
     algokit_key_cmp_fn cmp;
 };
@@ -36,29 +39,42 @@ struct algokit_graph {
     struct algokit_graph_map map;
 };
 
-static size_t algokit_graph_map_index(const struct algokit_graph_map *map, const void *key) {
-    return map->hash(key) % map->capacity;
+/* Capacities are powers of two (at least 8 slots); returns log2 of the rounded capacity. */
+static unsigned algokit_graph_map_bits(size_t capacity) {
+    unsigned bits = 3;
+
+    while (((size_t)1 << bits) < capacity) {
+        bits++;
+    }
+    return bits;
+}
+
+/* Fibonacci hashing: multiply by 2^64/phi and keep the top bits as the slot. */
+static size_t algokit_graph_map_index(const struct algokit_graph_map *map, size_t hash) {
+    return (size_t)(((uint64_t)hash * UINT64_C(0x9E3779B97F4A7C15)) >> map->shift);
 }
 
 static int algokit_graph_map_resize(struct algokit_graph_map *map, size_t new_capacity) {
     size_t i;
     struct algokit_graph_map_entry *old_entries = map->entries;
     size_t old_capacity = map->capacity;
+    unsigned bits = algokit_graph_map_bits(new_capacity);
 
-    map->entries = (struct algokit_graph_map_entry *)calloc(new_capacity, sizeof(*map->entries));
+    map->entries = (struct algokit_graph_map_entry *)calloc((size_t)1 << bits, sizeof(*map->entries));
     if (!map->entries) {
         map->entries = old_entries;
         return -1;
     }
 
-    map->capacity = new_capacity;
+    map->capacity = (size_t)1 << bits;
+    map->shift = 64u - bits;
     map->size = 0;
 
     for (i = 0; i < old_capacity; i++) {
         if (old_entries[i].state == 1) {
-            size_t idx = algokit_graph_map_index(map, old_entries[i].key);
+            size_t idx = algokit_graph_map_index(map, old_entries[i].hash);
             while (map->entries[idx].state == 1) {
-                idx = (idx + 1) % map->capacity;
+                idx = (idx + 1) & (map->capacity - 1);
             }
             map->entries[idx] = old_entries[i];
             map->entries[idx].state = 1;
@@ -71,25 +87,29 @@ static int algokit_graph_map_resize(struct algokit_graph_map *map, size_t new_ca
 }
 
 static int algokit_graph_map_get(const struct algokit_graph_map *map, const void *key, size_t *out_index) {
+    size_t hash;
     size_t idx;
 
     if (!map || !key || !out_index) {
         return -1;
     }
 
-    idx = algokit_graph_map_index(map, key);
+    hash = map->hash(key);
+    idx = algokit_graph_map_index(map, hash);
     while (map->entries[idx].state != 0) {
-        if (map->entries[idx].state == 1 && map->cmp(map->entries[idx].key, key) == 0) {
+        if (map->entries[idx].state == 1 && map->entries[idx].hash == hash &&
+            map->cmp(map->entries[idx].key, key) == 0) {
             *out_index = map->entries[idx].index;
             return 0;
         }
-        idx = (idx + 1) % map->capacity;
+        idx = (idx + 1) & (map->capacity - 1);
     }
 
     return 1;
 }
 
 static int algokit_graph_map_put(struct algokit_graph_map *map, void *key, size_t index) {
+    size_t hash;
     size_t idx;
 
     if (!map) {
@@ -102,15 +122,17 @@ static int algokit_graph_map_put(struct algokit_graph_map *map, void *key, size_
         }
     }
 
-    idx = algokit_graph_map_index(map, key);
+    hash = map->hash(key);
+    idx = algokit_graph_map_index(map, hash);
     while (map->entries[idx].state == 1) {
-        if (map->cmp(map->entries[idx].key, key) == 0) {
+        if (map->entries[idx].hash == hash && map->cmp(map->entries[idx].key, key) == 0) {
             return 1;
         }
-        idx = (idx + 1) % map->capacity;
+        idx = (idx + 1) & (map->capacity - 1);
     }
 
     map->entries[idx].key = key;
+    map->entries[idx].hash = hash;
     map->entries[idx].index = index;
     map->entries[idx].state = 1;
     map->size++;
@@ -127,6 +149,7 @@ static void algokit_graph_free_edges(struct algokit_graph_edge *edge) {
 
 algokit_graph *algokit_graph_create(size_t capacity, algokit_key_hash_fn hash, algokit_key_cmp_fn cmp) {
     algokit_graph *graph;
+    unsigned bits;
 
     if (!hash || !cmp || capacity == 0) {
         return NULL;
@@ -146,13 +169,15 @@ algokit_graph *algokit_graph_create(size_t capacity, algokit_key_hash_fn hash, a
     graph->size = 0;
     graph->capacity = capacity;
 
-    graph->map.entries = (struct algokit_graph_map_entry *)calloc(capacity, sizeof(*graph->map.entries));
+    bits = algokit_graph_map_bits(capacity);
+    graph->map.entries = (struct algokit_graph_map_entry *)calloc((size_t)1 << bits, sizeof(*graph->map.entries));
     if (!graph->map.entries) {
         free(graph->vertices);
         free(graph);
         return NULL;
     }
-    graph->map.capacity = capacity;
+    graph->map.capacity = (size_t)1 << bits;
+    graph->map.shift = 64u - bits;
     graph->map.size = 0;
     graph->map.hash = hash;
     graph->map.cmp = cmp;
@@ -0,0 +1,306 @@
+#include "algokit/hash.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hash_internal.h"
+#include "pool.h"
+
+/*
+ * A block is one cache line on 64-bit targets: 3 inline Items, a 1-byte
+ * fingerprint per Item, a fill count and an overflow pointer. The bucket
+ * array stores the first block of each chain inline, so a lookup in a
+ * bucket holding up to 3 items touches a single line.
+ */
+#define ALGOKIT_HASH_BC_SLOTS 3
+#define ALGOKIT_HASH_BC_LINE 64
+#define ALGOKIT_HASH_BC_BLOCKS_PER_SLAB 128
+
+struct algokit_hash_bc_block {
+    unsigned char tags[ALGOKIT_HASH_BC_SLOTS];
+    unsigned char count;
+    struct algokit_hash_bc_block *next;
+    Item items[ALGOKIT_HASH_BC_SLOTS];
+};
+
+struct algokit_hash_bc {
+    struct algokit_hash_bc_block *buckets;
+    void *buckets_raw;
+    size_t capacity;
+    size_t size;
+    unsigned shift;
+    struct algokit_pool pool;
+    algokit_key_hash_fn hash;
+    algokit_key_cmp_fn cmp;
+};
+
+static unsigned algokit_hash_bc_bits(size_t capacity) {
+    unsigned bits = 3;
+
+    while (((size_t)1 << bits) < capacity) {
+        bits++;
+    }
+    return bits;
+}
+
+static size_t algokit_hash_bc_index(const algokit_hash_bc *table, size_t hash) {
+    return (size_t)(((uint64_t)hash * UINT64_C(0x9E3779B97F4A7C15)) >> table->shift);
+}
+
+/* The fingerprint uses a second multiplier so it is independent of the bucket bits. */
+static unsigned char algokit_hash_bc_tag(size_t hash) {
+    return (unsigned char)(((uint64_t)hash * UINT64_C(0xFF51AFD7ED558CCD)) >> 56);
+}
+
+/* C99 has no aligned allocation: over-allocate and round the start up to a cache line. */
+static int algokit_hash_bc_alloc(algokit_hash_bc *table, size_t capacity) {
+    unsigned bits = algokit_hash_bc_bits(capacity);
+    size_t bytes = ((size_t)1 << bits) * sizeof(struct algokit_hash_bc_block);
+    void *raw = malloc(bytes + ALGOKIT_HASH_BC_LINE - 1);
+    uintptr_t aligned;
+
+    if (!raw) {
+        return -1;
+    }
+
+    aligned = ((uintptr_t)raw + ALGOKIT_HASH_BC_LINE - 1) & ~(uintptr_t)(ALGOKIT_HASH_BC_LINE - 1);
+    table->buckets = (struct algokit_hash_bc_block *)aligned;
+    table->buckets_raw = raw;
+    memset(table->buckets, 0, bytes);
+    table->capacity = (size_t)1 << bits;
+    table->shift = 64u - bits;
+    return 0;
+}
+
+static int algokit_hash_bc_append(algokit_hash_bc *table, struct algokit_hash_bc_block *block, Item item,
+                                  unsigned char tag) {
+    while (block->count == ALGOKIT_HASH_BC_SLOTS) {
+        if (!block->next) {
+            struct algokit_hash_bc_block *extra = (struct algokit_hash_bc_block *)algokit_pool_alloc(&table->pool);
+            if (!extra) {
+                return -1;
+            }
+            memset(extra, 0, sizeof(*extra));
+            block->next = extra;
+        }
+        block = block->next;
+    }
+
+    block->tags[block->count] = tag;
+    block->items[block->count] = item;
+    block->count++;
+    return 0;
+}
+
+static void algokit_hash_bc_free_overflow(algokit_hash_bc *table, struct algokit_hash_bc_block *block) {
+    struct algokit_hash_bc_block *extra = block->next;
+
+    while (extra) {
+        struct algokit_hash_bc_block *next = extra->next;
+        algokit_pool_free(&table->pool, extra);
+        extra = next;
+    }
+}
+
+/*
+ * Blocks keep no cached hash, only an 8-bit fingerprint, so resizing calls
+ * the hash function again for every item. Items are copied into a separate
+ * array and the table switches to it only once every item has moved: if an
+ * overflow block cannot be allocated, the new array is dropped instead and
+ * the table is left as it was.
+ */
+static int algokit_hash_bc_resize(algokit_hash_bc *table, size_t new_capacity) {
+    algokit_hash_bc next;
+    algokit_hash_bc *dropped;
+    size_t i;
+    int rc = 0;
+
+    if (algokit_hash_bc_alloc(&next, new_capacity) != 0) {
+        return -1;
+    }
+
+    for (i = 0; rc == 0 && i < table->capacity; i++) {
+        const struct algokit_hash_bc_block *block;
+
+        for (block = &table->buckets[i]; rc == 0 && block; block = block->next) {
+            unsigned j;
+            for (j = 0; rc == 0 && j < block->count; j++) {
+                size_t hash = table->hash(block->items[j].key);
+                struct algokit_hash_bc_block *target = &next.buckets[algokit_hash_bc_index(&next, hash)];
+                rc = algokit_hash_bc_append(table, target, block->items[j], block->tags[j]);
+            }
+        }
+    }
+
+    /* Both arrays draw overflow blocks from the table's pool; the one dropped gives them back. */
+    dropped = rc == 0 ? table : &next;
+    for (i = 0; i < dropped->capacity; i++) {
+        algokit_hash_bc_free_overflow(table, &dropped->buckets[i]);
+    }
+    free(dropped->buckets_raw);
+
+    if (rc == 0) {
+        table->buckets = next.buckets;
+        table->buckets_raw = next.buckets_raw;
+        table->capacity = next.capacity;
+        table->shift = next.shift;
+    }
+    return rc;
+}
+
+/* Finds key: returns the block holding it and its slot through *slot, or NULL. */
+static struct algokit_hash_bc_block *algokit_hash_bc_find(const algokit_hash_bc *table, const void *key, size_t hash,
+                                                          unsigned *slot) {
+    struct algokit_hash_bc_block *block = &table->buckets[algokit_hash_bc_index(table, hash)];
+    unsigned char tag = algokit_hash_bc_tag(hash);
+
+    for (; block; block = block->next) {
+        unsigned j;
+        for (j = 0; j < block->count; j++) {
+            if (block->tags[j] == tag && table->cmp(block->items[j].key, key) == 0) {
+                *slot = j;
+                return block;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+algokit_hash_bc *algokit_hash_bc_create_with(size_t capacity, algokit_key_hash_fn hash, algokit_key_cmp_fn cmp,
+                                             algokit_pool_alloc_fn slab_alloc) {
+    algokit_hash_bc *table;
+
+    if (!hash || !cmp || capacity == 0) {
+        return NULL;
+    }
+
+    table = (algokit_hash_bc *)malloc(sizeof(*table));
+    if (!table) {
+        return NULL;
+    }
+
+    if (algokit_hash_bc_alloc(table, capacity) != 0) {
+        free(table);
+        return NULL;
+    }
+
+    table->size = 0;
+    algokit_pool_init_with(&table->pool, sizeof(struct algokit_hash_bc_block), ALGOKIT_HASH_BC_BLOCKS_PER_SLAB, 0,
+                           slab_alloc);
+    table->hash = hash;
+    table->cmp = cmp;
+    return table;
+}
+
+algokit_hash_bc *algokit_hash_bc_create(size_t capacity, algokit_key_hash_fn hash, algokit_key_cmp_fn cmp) {
+    return algokit_hash_bc_create_with(capacity, hash, cmp, malloc);
+}
+
+void algokit_hash_bc_destroy(algokit_hash_bc *table, algokit_item_destroy_fn destroy) {
+    size_t i;
+
+    if (!table) {
+        return;
+    }
+
+    for (i = 0; destroy && i < table->capacity; i++) {
+        struct algokit_hash_bc_block *block;
+        for (block = &table->buckets[i]; block; block = block->next) {
+            unsigned j;
+            for (j = 0; j < block->count; j++) {
+                destroy(block->items[j].key, block->items[j].val);
+            }
+        }
+    }
+
+    algokit_pool_release(&table->pool);
+    free(table->buckets_raw);
+    free(table);
+}
+
+int algokit_hash_bc_put(algokit_hash_bc *table, Item item) {
+    size_t hash;
+    unsigned slot;
+
+    if (!table) {
+        return -1;
+    }
+
+    hash = table->hash(item.key);
+    if (algokit_hash_bc_find(table, item.key, hash, &slot)) {
+        return 1;
+    }
+
+    /* Grow past 2 items per bucket on average: most chains then still fit in their first block. */
+    if (table->size + 1 > table->capacity * 2) {
+        if (algokit_hash_bc_resize(table, table->capacity * 2) != 0) {
+            return -1;
+        }
+    }
+
+    if (algokit_hash_bc_append(table, &table->buckets[algokit_hash_bc_index(table, hash)], item,
+                               algokit_hash_bc_tag(hash)) != 0) {
+        return -1;
+    }
+    table->size++;
+    return 0;
+}
+
+int algokit_hash_bc_get(const algokit_hash_bc *table, const void *key, Item *out) {
+    struct algokit_hash_bc_block *block;
+    unsigned slot;
+
+    if (!table || !key || !out) {
+        return -1;
+    }
+
+    block = algokit_hash_bc_find(table, key, table->hash(key), &slot);
+    if (!block) {
+        return 1;
+    }
+
+    *out = block->items[slot];
+    return 0;
+}
+
+int algokit_hash_bc_delete(algokit_hash_bc *table, const void *key, Item *out) {
+    struct algokit_hash_bc_block *block;
+    struct algokit_hash_bc_block *last;
+    struct algokit_hash_bc_block *before_last = NULL;
+    size_t hash;
+    unsigned slot;
+
+    if (!table || !key || !out) {
+        return -1;
+    }
+
+    hash = table->hash(key);
+    block = algokit_hash_bc_find(table, key, hash, &slot);
+    if (!block) {
+        return 1;
+    }
+
+    *out = block->items[slot];
+
+    /* Keep blocks dense: the last item of the chain fills the hole. */
+    last = &table->buckets[algokit_hash_bc_index(table, hash)];
+    while (last->next) {
+        before_last = last;
+        last = last->next;
+    }
+    last->count--;
+    block->items[slot] = last->items[last->count];
+    block->tags[slot] = last->tags[last->count];
+    if (last->count == 0 && before_last) {
+        before_last->next = NULL;
+        algokit_pool_free(&table->pool, last);
+    }
+    table->size--;
+
+    if (table->capacity > 8 && table->size < table->capacity / 4) {
+        algokit_hash_bc_resize(table, table->capacity / 2);
+    }
+    return 0;
+}
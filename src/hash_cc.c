@@ -0,0 +1,688 @@
+#define _POSIX_C_SOURCE 200112L
+
+#include "algokit/hash_cc.h"
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/* Shards and readers are allocated on, and padded to, this boundary. */
+#define ALGOKIT_HASH_CC_LINE 64
+
+#define ALGOKIT_HASH_CC_PADDED(bytes) \
+    (((bytes) + ALGOKIT_HASH_CC_LINE - 1) / ALGOKIT_HASH_CC_LINE * ALGOKIT_HASH_CC_LINE)
+
+/* Optimistic attempts before a reader gives up and takes the shard mutex. */
+#define ALGOKIT_HASH_CC_READ_TRIES 4
+
+/* Retired entries a shard collects between two reclamation passes. */
+#define ALGOKIT_HASH_CC_RETIRE_BATCH 64
+
+#if defined(__GNUC__)
+#define ALGOKIT_HASH_CC_LOCK_FREE 1
+#define ALGOKIT_HASH_CC_LOAD(ptr, order) __atomic_load_n((ptr), __ATOMIC_##order)
+#define ALGOKIT_HASH_CC_STORE(ptr, value, order) __atomic_store_n((ptr), (value), __ATOMIC_##order)
+#define ALGOKIT_HASH_CC_FENCE(order) __atomic_thread_fence(__ATOMIC_##order)
+#else
+/* Without atomic builtins every reader takes the shard mutex, so plain accesses are enough. */
+#define ALGOKIT_HASH_CC_LOCK_FREE 0
+#define ALGOKIT_HASH_CC_LOAD(ptr, order) (*(ptr))
+#define ALGOKIT_HASH_CC_STORE(ptr, value, order) ((void)(*(ptr) = (value)))
+#define ALGOKIT_HASH_CC_FENCE(order) ((void)0)
+#endif
+
+/* Address used as the key of a deleted slot; never a user key. */
+static char algokit_hash_cc_tombstone;
+
+#define ALGOKIT_HASH_CC_TOMBSTONE ((void *)&algokit_hash_cc_tombstone)
+
+/* key is NULL for an empty slot and ALGOKIT_HASH_CC_TOMBSTONE for a deleted one. */
+struct algokit_hash_cc_slot {
+    void *key;
+    void *val;
+    size_t hash;
+};
+
+/* capacity and shift never change once the array is published. */
+struct algokit_hash_cc_array {
+    size_t capacity;
+    unsigned shift;
+    struct algokit_hash_cc_slot slots[];
+};
+
+/* A deleted item (array is NULL) or a replaced array, freed once the map epoch reaches epoch + 2. */
+struct algokit_hash_cc_retired {
+    Item item;
+    struct algokit_hash_cc_array *array;
+    size_t epoch;
+};
+
+/*
+ * lock is taken by writers only. seq is odd while a writer changes slots;
+ * a lock-free reader reads it before and after probing and retries if it
+ * moved. retired holds what writers removed while readers may still see it.
+ */
+struct algokit_hash_cc_shard {
+    pthread_mutex_t lock;
+    struct algokit_hash_cc_array *array;
+    size_t seq;
+    size_t size;
+    size_t tombstones;
+    struct algokit_hash_cc_retired *retired;
+    size_t retired_count;
+    size_t retired_capacity;
+    size_t reclaim_at;
+};
+
+/* Whole cache lines per shard, so neighbouring shards never share one. */
+union algokit_hash_cc_padded_shard {
+    struct algokit_hash_cc_shard shard;
+    char pad[ALGOKIT_HASH_CC_PADDED(sizeof(struct algokit_hash_cc_shard))];
+};
+
+/*
+ * epoch is 0 outside a read section, otherwise the map epoch the reader
+ * entered under. depth counts nested enter calls and is private to the
+ * owning thread.
+ */
+struct algokit_hash_cc_reader {
+    size_t epoch;
+    size_t depth;
+    struct algokit_hash_cc_reader *next;
+};
+
+/*
+ * epoch only moves forward, once every registered reader inside a read
+ * section has entered under the current value; readers_lock guards the reader list and
+ * serializes those advances.
+ */
+struct algokit_hash_cc {
+    union algokit_hash_cc_padded_shard *shards;
+    size_t shard_count;
+    size_t epoch;
+    pthread_mutex_t readers_lock;
+    algokit_hash_cc_reader *readers;
+    algokit_key_hash_fn hash;
+    algokit_key_cmp_fn cmp;
+    algokit_item_destroy_fn retire;
+};
+
+/*
+ * The shard tables index with the top bits of hash * 2^64/phi, so the
+ * shard is picked from a different mix to keep the two choices independent.
+ * Callers reuse the same hash inside the shard, so each key is hashed once
+ * per operation.
+ */
+static struct algokit_hash_cc_shard *algokit_hash_cc_shard_for(const algokit_hash_cc *table, size_t hash) {
+    uint64_t x = (uint64_t)hash;
+
+    x ^= x >> 33;
+    x *= UINT64_C(0xFF51AFD7ED558CCD);
+    x ^= x >> 33;
+    return &table->shards[(size_t)x & (table->shard_count - 1)].shard;
+}
+
+static size_t algokit_hash_cc_index(const struct algokit_hash_cc_array *array, size_t hash) {
+    return (size_t)(((uint64_t)hash * UINT64_C(0x9E3779B97F4A7C15)) >> array->shift);
+}
+
+/* Smallest capacity that holds count items without reaching the 70% growth threshold. */
+static size_t algokit_hash_cc_capacity_for(size_t count) {
+    size_t capacity = 8;
+
+    while (count * 10 >= capacity * 7) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+static struct algokit_hash_cc_array *algokit_hash_cc_array_create(size_t capacity) {
+    struct algokit_hash_cc_array *array;
+    unsigned bits = 3;
+
+    while (((size_t)1 << bits) < capacity) {
+        bits++;
+    }
+
+    array = (struct algokit_hash_cc_array *)calloc(1, sizeof(*array) + ((size_t)1 << bits) * sizeof(array->slots[0]));
+    if (!array) {
+        return NULL;
+    }
+
+    array->capacity = (size_t)1 << bits;
+    array->shift = 64u - bits;
+    return array;
+}
+
+/* Writer-side lookup under the shard lock; returns the slot index or (size_t)-1. */
+static size_t algokit_hash_cc_find(const algokit_hash_cc *table, const struct algokit_hash_cc_array *array,
+                                   const void *key, size_t hash) {
+    size_t mask = array->capacity - 1;
+    size_t idx = algokit_hash_cc_index(array, hash);
+
+    while (array->slots[idx].key) {
+        if (array->slots[idx].key != ALGOKIT_HASH_CC_TOMBSTONE && array->slots[idx].hash == hash &&
+            table->cmp(array->slots[idx].key, key) == 0) {
+            return idx;
+        }
+        idx = (idx + 1) & mask;
+    }
+
+    return (size_t)-1;
+}
+
+/*
+ * Reader-side lookup. Writers may change slots meanwhile, so every load is
+ * atomic and the caller throws the result away if the shard's seq moved.
+ * The loop is bounded because such a torn view may contain no empty slot.
+ */
+static int algokit_hash_cc_probe(const algokit_hash_cc *table, const struct algokit_hash_cc_array *array,
+                                 const void *key, size_t hash, Item *out) {
+    size_t mask = array->capacity - 1;
+    size_t idx = algokit_hash_cc_index(array, hash);
+    size_t steps;
+
+    for (steps = 0; steps < array->capacity; steps++) {
+        void *slot_key = ALGOKIT_HASH_CC_LOAD(&array->slots[idx].key, ACQUIRE);
+
+        if (!slot_key) {
+            return 1;
+        }
+        if (slot_key != ALGOKIT_HASH_CC_TOMBSTONE && ALGOKIT_HASH_CC_LOAD(&array->slots[idx].hash, RELAXED) == hash &&
+            table->cmp(slot_key, key) == 0) {
+            out->key = slot_key;
+            out->val = ALGOKIT_HASH_CC_LOAD(&array->slots[idx].val, RELAXED);
+            return 0;
+        }
+        idx = (idx + 1) & mask;
+    }
+
+    return 1;
+}
+
+/* Seqlock write side: readers that overlap begin..end see seq change and retry. */
+static void algokit_hash_cc_write_begin(struct algokit_hash_cc_shard *shard) {
+    ALGOKIT_HASH_CC_STORE(&shard->seq, shard->seq + 1, RELAXED);
+    ALGOKIT_HASH_CC_FENCE(RELEASE);
+}
+
+static void algokit_hash_cc_write_end(struct algokit_hash_cc_shard *shard) {
+    ALGOKIT_HASH_CC_STORE(&shard->seq, shard->seq + 1, RELEASE);
+}
+
+static int algokit_hash_cc_reserve_retired(struct algokit_hash_cc_shard *shard) {
+    struct algokit_hash_cc_retired *grown;
+    size_t capacity;
+
+    if (shard->retired_count < shard->retired_capacity) {
+        return 0;
+    }
+
+    capacity = shard->retired_capacity ? shard->retired_capacity * 2 : ALGOKIT_HASH_CC_RETIRE_BATCH;
+    grown = (struct algokit_hash_cc_retired *)realloc(shard->retired, capacity * sizeof(*grown));
+    if (!grown) {
+        return -1;
+    }
+
+    shard->retired = grown;
+    shard->retired_capacity = capacity;
+    return 0;
+}
+
+/* Needs a slot from algokit_hash_cc_reserve_retired; call only after the entry is unreachable. */
+static void algokit_hash_cc_retire(algokit_hash_cc *table, struct algokit_hash_cc_shard *shard, Item item,
+                                   struct algokit_hash_cc_array *array) {
+    struct algokit_hash_cc_retired *retired = &shard->retired[shard->retired_count++];
+
+    /* Readers announcing the epoch read below start after the unlink, so they cannot reach the entry. */
+    ALGOKIT_HASH_CC_FENCE(SEQ_CST);
+    retired->item = item;
+    retired->array = array;
+    retired->epoch = ALGOKIT_HASH_CC_LOAD(&table->epoch, SEQ_CST);
+}
+
+static void algokit_hash_cc_advance(algokit_hash_cc *table) {
+    algokit_hash_cc_reader *reader;
+    size_t epoch;
+    int ready = 1;
+
+    pthread_mutex_lock(&table->readers_lock);
+    epoch = ALGOKIT_HASH_CC_LOAD(&table->epoch, SEQ_CST);
+    for (reader = table->readers; reader && ready; reader = reader->next) {
+        size_t seen = ALGOKIT_HASH_CC_LOAD(&reader->epoch, SEQ_CST);
+
+        ready = seen == 0 || seen == epoch;
+    }
+    if (ready) {
+        ALGOKIT_HASH_CC_STORE(&table->epoch, epoch + 1, SEQ_CST);
+    }
+    pthread_mutex_unlock(&table->readers_lock);
+}
+
+/*
+ * Two advances after an entry was retired, every reader that could have
+ * loaded it has left get, so it is freed (or handed to retire) here.
+ */
+static void algokit_hash_cc_reclaim(algokit_hash_cc *table, struct algokit_hash_cc_shard *shard) {
+    size_t epoch;
+    size_t kept = 0;
+    size_t i;
+
+    algokit_hash_cc_advance(table);
+    epoch = ALGOKIT_HASH_CC_LOAD(&table->epoch, SEQ_CST);
+    for (i = 0; i < shard->retired_count; i++) {
+        struct algokit_hash_cc_retired *retired = &shard->retired[i];
+
+        if (retired->epoch + 2 > epoch) {
+            shard->retired[kept++] = *retired;
+        } else if (retired->array) {
+            free(retired->array);
+        } else {
+            table->retire(retired->item.key, retired->item.val);
+        }
+    }
+    shard->retired_count = kept;
+    shard->reclaim_at = kept + ALGOKIT_HASH_CC_RETIRE_BATCH;
+}
+
+/* Copies the live slots into a fresh array, publishes it, and retires the old one. */
+static int algokit_hash_cc_rebuild(algokit_hash_cc *table, struct algokit_hash_cc_shard *shard, size_t capacity) {
+    struct algokit_hash_cc_array *old = shard->array;
+    struct algokit_hash_cc_array *next;
+    Item none;
+    size_t i;
+
+    if (algokit_hash_cc_reserve_retired(shard) != 0) {
+        return -1;
+    }
+    next = algokit_hash_cc_array_create(capacity);
+    if (!next) {
+        return -1;
+    }
+
+    /* next is private until published, so plain stores are enough. */
+    for (i = 0; i < old->capacity; i++) {
+        if (old->slots[i].key && old->slots[i].key != ALGOKIT_HASH_CC_TOMBSTONE) {
+            size_t idx = algokit_hash_cc_index(next, old->slots[i].hash);
+
+            while (next->slots[idx].key) {
+                idx = (idx + 1) & (next->capacity - 1);
+            }
+            next->slots[idx] = old->slots[i];
+        }
+    }
+
+    /* Readers already probing old finish there; it is retired, not freed. */
+    ALGOKIT_HASH_CC_STORE(&shard->array, next, RELEASE);
+    shard->tombstones = 0;
+    none.key = NULL;
+    none.val = NULL;
+    algokit_hash_cc_retire(table, shard, none, old);
+    /* Arrays are large: try to free them after this operation rather than after a full batch. */
+    shard->reclaim_at = shard->retired_count;
+    return 0;
+}
+
+/*
+ * Lock-free read inside a read section: probe between two loads of seq.
+ * Returns -1 when every try overlapped a writer, and the caller falls back
+ * to the shard mutex.
+ */
+static int algokit_hash_cc_read(const algokit_hash_cc *table, struct algokit_hash_cc_shard *shard, const void *key,
+                                size_t hash, Item *out) {
+    Item found;
+    int rc = -1;
+    int tries;
+
+    for (tries = 0; rc == -1 && tries < ALGOKIT_HASH_CC_READ_TRIES; tries++) {
+        size_t seq = ALGOKIT_HASH_CC_LOAD(&shard->seq, ACQUIRE);
+
+        if (seq & 1) {
+            continue;
+        }
+        rc = algokit_hash_cc_probe(table, ALGOKIT_HASH_CC_LOAD(&shard->array, ACQUIRE), key, hash, &found);
+        ALGOKIT_HASH_CC_FENCE(ACQUIRE);
+        if (ALGOKIT_HASH_CC_LOAD(&shard->seq, RELAXED) != seq) {
+            rc = -1;
+        }
+    }
+    if (rc == 0) {
+        *out = found;
+    }
+    return rc;
+}
+
+static void algokit_hash_cc_shard_free(algokit_hash_cc *table, struct algokit_hash_cc_shard *shard,
+                                       algokit_item_destroy_fn destroy) {
+    size_t i;
+
+    for (i = 0; i < shard->retired_count; i++) {
+        if (shard->retired[i].array) {
+            free(shard->retired[i].array);
+        } else {
+            table->retire(shard->retired[i].item.key, shard->retired[i].item.val);
+        }
+    }
+    for (i = 0; destroy && i < shard->array->capacity; i++) {
+        if (shard->array->slots[i].key && shard->array->slots[i].key != ALGOKIT_HASH_CC_TOMBSTONE) {
+            destroy(shard->array->slots[i].key, shard->array->slots[i].val);
+        }
+    }
+
+    pthread_mutex_destroy(&shard->lock);
+    free(shard->retired);
+    free(shard->array);
+}
+
+algokit_hash_cc *algokit_hash_cc_create(size_t shards, size_t capacity, algokit_key_hash_fn hash, algokit_key_cmp_fn cmp,
+                                        algokit_item_destroy_fn retire) {
+    algokit_hash_cc *table;
+    void *memory;
+    size_t count = 1;
+    size_t per_shard;
+    size_t i;
+
+    if (!hash || !cmp || shards == 0 || capacity == 0) {
+        return NULL;
+    }
+
+    while (count < shards) {
+        count *= 2;
+    }
+    per_shard = capacity / count + 1;
+
+    table = (algokit_hash_cc *)malloc(sizeof(*table));
+    if (!table) {
+        return NULL;
+    }
+    if (pthread_mutex_init(&table->readers_lock, NULL) != 0) {
+        free(table);
+        return NULL;
+    }
+    if (posix_memalign(&memory, ALGOKIT_HASH_CC_LINE, count * sizeof(*table->shards)) != 0) {
+        pthread_mutex_destroy(&table->readers_lock);
+        free(table);
+        return NULL;
+    }
+    table->shards = (union algokit_hash_cc_padded_shard *)memory;
+
+    for (i = 0; i < count; i++) {
+        struct algokit_hash_cc_shard *shard = &table->shards[i].shard;
+
+        shard->array = algokit_hash_cc_array_create(algokit_hash_cc_capacity_for(per_shard));
+        if (!shard->array || pthread_mutex_init(&shard->lock, NULL) != 0) {
+            free(shard->array);
+            while (i-- > 0) {
+                algokit_hash_cc_shard_free(table, &table->shards[i].shard, NULL);
+            }
+            free(table->shards);
+            pthread_mutex_destroy(&table->readers_lock);
+            free(table);
+            return NULL;
+        }
+        shard->seq = 0;
+        shard->size = 0;
+        shard->tombstones = 0;
+        shard->retired = NULL;
+        shard->retired_count = 0;
+        shard->retired_capacity = 0;
+        shard->reclaim_at = ALGOKIT_HASH_CC_RETIRE_BATCH;
+    }
+
+    table->shard_count = count;
+    table->epoch = 1;
+    table->readers = NULL;
+    table->hash = hash;
+    table->cmp = cmp;
+    table->retire = retire;
+    return table;
+}
+
+void algokit_hash_cc_destroy(algokit_hash_cc *table, algokit_item_destroy_fn destroy) {
+    size_t i;
+
+    if (!table) {
+        return;
+    }
+
+    for (i = 0; i < table->shard_count; i++) {
+        algokit_hash_cc_shard_free(table, &table->shards[i].shard, destroy);
+    }
+    /* Readers nobody unregistered go with the map. */
+    while (table->readers) {
+        algokit_hash_cc_reader *next = table->readers->next;
+
+        free(table->readers);
+        table->readers = next;
+    }
+
+    pthread_mutex_destroy(&table->readers_lock);
+    free(table->shards);
+    free(table);
+}
+
+algokit_hash_cc_reader *algokit_hash_cc_reader_create(algokit_hash_cc *table) {
+    algokit_hash_cc_reader *reader;
+    void *memory;
+
+    if (!table) {
+        return NULL;
+    }
+
+    /* A whole line per reader: announcing an epoch never invalidates another thread's line. */
+    if (posix_memalign(&memory, ALGOKIT_HASH_CC_LINE, ALGOKIT_HASH_CC_PADDED(sizeof(*reader))) != 0) {
+        return NULL;
+    }
+    reader = (algokit_hash_cc_reader *)memory;
+    reader->epoch = 0;
+    reader->depth = 0;
+
+    pthread_mutex_lock(&table->readers_lock);
+    reader->next = table->readers;
+    table->readers = reader;
+    pthread_mutex_unlock(&table->readers_lock);
+    return reader;
+}
+
+void algokit_hash_cc_reader_destroy(algokit_hash_cc *table, algokit_hash_cc_reader *reader) {
+    algokit_hash_cc_reader **link;
+
+    if (!table || !reader) {
+        return;
+    }
+
+    pthread_mutex_lock(&table->readers_lock);
+    link = &table->readers;
+    while (*link && *link != reader) {
+        link = &(*link)->next;
+    }
+    if (*link) {
+        *link = reader->next;
+    }
+    pthread_mutex_unlock(&table->readers_lock);
+    free(reader);
+}
+
+void algokit_hash_cc_reader_enter(const algokit_hash_cc *table, algokit_hash_cc_reader *reader) {
+    if (!table || !reader || reader->depth++ > 0) {
+        return;
+    }
+
+    /* The announcement must be visible before any slot is read, hence the full fence. */
+    ALGOKIT_HASH_CC_STORE(&reader->epoch, ALGOKIT_HASH_CC_LOAD(&table->epoch, SEQ_CST), RELAXED);
+    ALGOKIT_HASH_CC_FENCE(SEQ_CST);
+}
+
+void algokit_hash_cc_reader_leave(const algokit_hash_cc *table, algokit_hash_cc_reader *reader) {
+    if (!table || !reader || reader->depth == 0 || --reader->depth > 0) {
+        return;
+    }
+
+    ALGOKIT_HASH_CC_STORE(&reader->epoch, (size_t)0, RELEASE);
+}
+
+static int algokit_hash_cc_put_locked(algokit_hash_cc *table, struct algokit_hash_cc_shard *shard, Item item,
+                                      size_t hash) {
+    struct algokit_hash_cc_array *array = shard->array;
+    size_t idx;
+
+    if (algokit_hash_cc_find(table, array, item.key, hash) != (size_t)-1) {
+        return 1;
+    }
+
+    /* Tombstones lengthen probes like items do, so both count towards the threshold. */
+    if ((shard->size + shard->tombstones + 1) * 10 >= array->capacity * 7) {
+        if (algokit_hash_cc_rebuild(table, shard, algokit_hash_cc_capacity_for(shard->size + 1)) != 0) {
+            return -1;
+        }
+        array = shard->array;
+    }
+
+    idx = algokit_hash_cc_index(array, hash);
+    while (array->slots[idx].key && array->slots[idx].key != ALGOKIT_HASH_CC_TOMBSTONE) {
+        idx = (idx + 1) & (array->capacity - 1);
+    }
+    if (array->slots[idx].key == ALGOKIT_HASH_CC_TOMBSTONE) {
+        shard->tombstones--;
+    }
+
+    /* key goes last: a reader that loads it also sees its hash and val. */
+    algokit_hash_cc_write_begin(shard);
+    ALGOKIT_HASH_CC_STORE(&array->slots[idx].hash, hash, RELAXED);
+    ALGOKIT_HASH_CC_STORE(&array->slots[idx].val, item.val, RELAXED);
+    ALGOKIT_HASH_CC_STORE(&array->slots[idx].key, item.key, RELEASE);
+    algokit_hash_cc_write_end(shard);
+    shard->size++;
+    return 0;
+}
+
+int algokit_hash_cc_put(algokit_hash_cc *table, Item item) {
+    struct algokit_hash_cc_shard *shard;
+    size_t hash;
+    int rc;
+
+    if (!table || !item.key) {
+        return -1;
+    }
+
+    hash = table->hash(item.key);
+    shard = algokit_hash_cc_shard_for(table, hash);
+    if (pthread_mutex_lock(&shard->lock) != 0) {
+        return -1;
+    }
+    rc = algokit_hash_cc_put_locked(table, shard, item, hash);
+    if (shard->retired_count >= shard->reclaim_at) {
+        algokit_hash_cc_reclaim(table, shard);
+    }
+    pthread_mutex_unlock(&shard->lock);
+    return rc;
+}
+
+int algokit_hash_cc_get(const algokit_hash_cc *table, algokit_hash_cc_reader *reader, const void *key, Item *out) {
+    struct algokit_hash_cc_shard *shard;
+    size_t hash;
+    int rc = -1;
+
+    if (!table || !key || !out) {
+        return -1;
+    }
+
+    hash = table->hash(key);
+    shard = algokit_hash_cc_shard_for(table, hash);
+    if (ALGOKIT_HASH_CC_LOCK_FREE && reader) {
+        algokit_hash_cc_reader_enter(table, reader);
+        rc = algokit_hash_cc_read(table, shard, key, hash, out);
+        algokit_hash_cc_reader_leave(table, reader);
+    }
+    if (rc == -1) {
+        if (pthread_mutex_lock(&shard->lock) != 0) {
+            return -1;
+        }
+        rc = algokit_hash_cc_probe(table, shard->array, key, hash, out);
+        pthread_mutex_unlock(&shard->lock);
+    }
+    return rc;
+}
+
+static int algokit_hash_cc_delete_locked(algokit_hash_cc *table, struct algokit_hash_cc_shard *shard, const void *key,
+                                         size_t hash, Item *out) {
+    struct algokit_hash_cc_array *array = shard->array;
+    Item item;
+    size_t idx;
+
+    idx = algokit_hash_cc_find(table, array, key, hash);
+    if (idx == (size_t)-1) {
+        return 1;
+    }
+    if (table->retire && algokit_hash_cc_reserve_retired(shard) != 0) {
+        return -1;
+    }
+
+    item.key = array->slots[idx].key;
+    item.val = array->slots[idx].val;
+    algokit_hash_cc_write_begin(shard);
+    ALGOKIT_HASH_CC_STORE(&array->slots[idx].key, ALGOKIT_HASH_CC_TOMBSTONE, RELAXED);
+    algokit_hash_cc_write_end(shard);
+    shard->size--;
+    shard->tombstones++;
+
+    if (out) {
+        *out = item;
+    }
+    if (table->retire) {
+        algokit_hash_cc_retire(table, shard, item, NULL);
+    }
+
+    /* Best effort: if the smaller array cannot be allocated the shard keeps the current one. */
+    if (array->capacity > 8 && shard->size * 10 <= array->capacity * 2) {
+        algokit_hash_cc_rebuild(table, shard, array->capacity / 2);
+    }
+    return 0;
+}
+
+int algokit_hash_cc_delete(algokit_hash_cc *table, const void *key, Item *out) {
+    struct algokit_hash_cc_shard *shard;
+    size_t hash;
+    int rc;
+
+    if (!table || !key) {
+        return -1;
+    }
+
+    hash = table->hash(key);
+    shard = algokit_hash_cc_shard_for(table, hash);
+    if (pthread_mutex_lock(&shard->lock) != 0) {
+        return -1;
+    }
+    rc = algokit_hash_cc_delete_locked(table, shard, key, hash, out);
+    if (shard->retired_count >= shard->reclaim_at) {
+        algokit_hash_cc_reclaim(table, shard);
+    }
+    pthread_mutex_unlock(&shard->lock);
+    return rc;
+}
+
+size_t algokit_hash_cc_size(const algokit_hash_cc *table) {
+    size_t total = 0;
+    size_t i;
+
+    if (!table) {
+        return 0;
+    }
+
+    /* Each shard is read under its lock; the sum is a snapshot, not a global one. */
+    for (i = 0; i < table->shard_count; i++) {
+        pthread_mutex_lock(&table->shards[i].shard.lock);
+        total += table->shards[i].shard.size;
+        pthread_mutex_unlock(&table->shards[i].shard.lock);
+    }
+    return total;
+}
+
+size_t algokit_hash_cc_shard_count(const algokit_hash_cc *table) {
+    if (!table) {
+        return 0;
+    }
+
+    return table->shard_count;
+}
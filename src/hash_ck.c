@@ -0,0 +1,456 @@
+#include "algokit/hash.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__GNUC__)
+#define ALGOKIT_HASH_CK_PREFETCH(addr) __builtin_prefetch(addr)
+#else
+#define ALGOKIT_HASH_CK_PREFETCH(addr) ((void)(addr))
+#endif
+
+/*
+ * A bucket is 4 Items, one cache line on 64-bit targets. Each slot also has
+ * an 8-bit tag (0 = empty) in a separate array, 4 bytes per bucket. The
+ * second bucket of an item is derived from its first bucket and its tag
+ * alone (partial-key cuckoo hashing), so items can be displaced without
+ * calling hash again.
+ */
+#define ALGOKIT_HASH_CK_SLOTS 4
+#define ALGOKIT_HASH_CK_LINE 64
+#define ALGOKIT_HASH_CK_MIN_BUCKETS 4
+#define ALGOKIT_HASH_CK_STASH 8
+#define ALGOKIT_HASH_CK_BFS_NODES 256
+#define ALGOKIT_HASH_CK_BFS_DEPTH 5
+
+struct algokit_hash_ck_bucket {
+    Item items[ALGOKIT_HASH_CK_SLOTS];
+};
+
+struct algokit_hash_ck_stashed {
+    Item item;
+    size_t hash;
+};
+
+struct algokit_hash_ck {
+    struct algokit_hash_ck_bucket *buckets;
+    void *buckets_raw;
+    unsigned char *tags;
+    size_t bucket_count;
+    size_t size;
+    unsigned shift;
+    struct algokit_hash_ck_stashed *stash;
+    size_t stash_count;
+    size_t stash_capacity;
+    algokit_key_hash_fn hash;
+    algokit_key_cmp_fn cmp;
+};
+
+/* One node of the breadth-first search for a free slot. */
+struct algokit_hash_ck_path {
+    size_t bucket;
+    int parent;
+    unsigned char slot;
+    unsigned char depth;
+};
+
+static size_t algokit_hash_ck_index(const algokit_hash_ck *table, size_t hash) {
+    return (size_t)(((uint64_t)hash * UINT64_C(0x9E3779B97F4A7C15)) >> table->shift);
+}
+
+static unsigned char algokit_hash_ck_tag(size_t hash) {
+    unsigned char tag = (unsigned char)(((uint64_t)hash * UINT64_C(0xFF51AFD7ED558CCD)) >> 56);
+    return tag ? tag : 1;
+}
+
+/* The offset is odd, so the two buckets always differ, and alt(alt(b)) == b. */
+static size_t algokit_hash_ck_alt(const algokit_hash_ck *table, size_t bucket, unsigned char tag) {
+    size_t offset = (size_t)(((uint32_t)tag * 0x5BD1E995u) | 1u);
+    return (bucket ^ offset) & (table->bucket_count - 1);
+}
+
+/* Smallest power-of-two bucket count whose slots hold capacity items at 90% load. */
+static size_t algokit_hash_ck_buckets_for(size_t capacity) {
+    size_t buckets = ALGOKIT_HASH_CK_MIN_BUCKETS;
+
+    while (buckets * ALGOKIT_HASH_CK_SLOTS * 9 < capacity * 10) {
+        buckets *= 2;
+    }
+    return buckets;
+}
+
+/* C99 has no aligned allocation: over-allocate and round the start up to a cache line. */
+static int algokit_hash_ck_alloc(algokit_hash_ck *table, size_t bucket_count) {
+    size_t bytes = bucket_count * sizeof(struct algokit_hash_ck_bucket);
+    void *raw = malloc(bytes + ALGOKIT_HASH_CK_LINE - 1);
+    unsigned char *tags = (unsigned char *)calloc(bucket_count, ALGOKIT_HASH_CK_SLOTS);
+    uintptr_t aligned;
+    unsigned bits = 0;
+
+    if (!raw || !tags) {
+        free(raw);
+        free(tags);
+        return -1;
+    }
+
+    while (((size_t)1 << bits) < bucket_count) {
+        bits++;
+    }
+
+    aligned = ((uintptr_t)raw + ALGOKIT_HASH_CK_LINE - 1) & ~(uintptr_t)(ALGOKIT_HASH_CK_LINE - 1);
+    table->buckets = (struct algokit_hash_ck_bucket *)aligned;
+    table->buckets_raw = raw;
+    table->tags = tags;
+    table->bucket_count = bucket_count;
+    table->shift = 64u - bits;
+    table->stash = NULL;
+    table->stash_count = 0;
+    table->stash_capacity = 0;
+    return 0;
+}
+
+static void algokit_hash_ck_free_arrays(algokit_hash_ck *table) {
+    free(table->buckets_raw);
+    free(table->tags);
+    free(table->stash);
+}
+
+static int algokit_hash_ck_take_free(algokit_hash_ck *table, size_t bucket, Item item, unsigned char tag) {
+    unsigned char *tags = &table->tags[bucket * ALGOKIT_HASH_CK_SLOTS];
+    unsigned s;
+
+    for (s = 0; s < ALGOKIT_HASH_CK_SLOTS; s++) {
+        if (tags[s] == 0) {
+            tags[s] = tag;
+            table->buckets[bucket].items[s] = item;
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*
+ * Breadth-first search from both candidate buckets for a free slot reachable
+ * by at most ALGOKIT_HASH_CK_BFS_DEPTH displacements, then moves the items
+ * along that path back to front so every move lands in an empty slot.
+ * Each move sends an item to the other bucket of its own pair, so the table
+ * stays valid even if a move is refused halfway (returns 1).
+ */
+static int algokit_hash_ck_bfs_insert(algokit_hash_ck *table, size_t first, Item item, unsigned char tag) {
+    struct algokit_hash_ck_path queue[ALGOKIT_HASH_CK_BFS_NODES];
+    int head = 0;
+    int tail = 2;
+
+    queue[0].bucket = first;
+    queue[0].parent = -1;
+    queue[0].slot = 0;
+    queue[0].depth = 0;
+    queue[1] = queue[0];
+    queue[1].bucket = algokit_hash_ck_alt(table, first, tag);
+
+    for (; head < tail; head++) {
+        const unsigned char *tags = &table->tags[queue[head].bucket * ALGOKIT_HASH_CK_SLOTS];
+        unsigned s;
+
+        for (s = 0; s < ALGOKIT_HASH_CK_SLOTS; s++) {
+            if (tags[s] == 0) {
+                int node = head;
+                unsigned hole = s;
+
+                while (queue[node].parent >= 0) {
+                    int parent = queue[node].parent;
+                    size_t from = queue[parent].bucket;
+                    size_t to = queue[node].bucket;
+                    unsigned char *src = &table->tags[from * ALGOKIT_HASH_CK_SLOTS + queue[node].slot];
+                    unsigned char *dst = &table->tags[to * ALGOKIT_HASH_CK_SLOTS + hole];
+
+                    if (*dst != 0 || *src == 0 || algokit_hash_ck_alt(table, from, *src) != to) {
+                        return 1;
+                    }
+                    *dst = *src;
+                    *src = 0;
+                    table->buckets[to].items[hole] = table->buckets[from].items[queue[node].slot];
+                    hole = queue[node].slot;
+                    node = parent;
+                }
+                if (table->tags[queue[node].bucket * ALGOKIT_HASH_CK_SLOTS + hole] != 0) {
+                    return 1;
+                }
+                table->tags[queue[node].bucket * ALGOKIT_HASH_CK_SLOTS + hole] = tag;
+                table->buckets[queue[node].bucket].items[hole] = item;
+                return 0;
+            }
+        }
+
+        if (queue[head].depth >= ALGOKIT_HASH_CK_BFS_DEPTH) {
+            continue;
+        }
+        for (s = 0; s < ALGOKIT_HASH_CK_SLOTS && tail < ALGOKIT_HASH_CK_BFS_NODES; s++) {
+            queue[tail].bucket = algokit_hash_ck_alt(table, queue[head].bucket, tags[s]);
+            queue[tail].parent = head;
+            queue[tail].slot = (unsigned char)s;
+            queue[tail].depth = (unsigned char)(queue[head].depth + 1);
+            tail++;
+        }
+    }
+
+    return 1;
+}
+
+/*
+ * Places an item whose key is known to be absent. Items that find no slot go
+ * to the stash; returns 1 if the stash already holds stash_limit items.
+ */
+static int algokit_hash_ck_insert(algokit_hash_ck *table, Item item, size_t hash, size_t stash_limit) {
+    size_t first = algokit_hash_ck_index(table, hash);
+    unsigned char tag = algokit_hash_ck_tag(hash);
+
+    if (algokit_hash_ck_take_free(table, first, item, tag) == 0 ||
+        algokit_hash_ck_take_free(table, algokit_hash_ck_alt(table, first, tag), item, tag) == 0 ||
+        algokit_hash_ck_bfs_insert(table, first, item, tag) == 0) {
+        return 0;
+    }
+
+    if (table->stash_count >= stash_limit) {
+        return 1;
+    }
+    if (table->stash_count == table->stash_capacity) {
+        size_t capacity = table->stash_capacity ? table->stash_capacity * 2 : ALGOKIT_HASH_CK_STASH;
+        struct algokit_hash_ck_stashed *stash =
+            (struct algokit_hash_ck_stashed *)realloc(table->stash, capacity * sizeof(*stash));
+        if (!stash) {
+            return -1;
+        }
+        table->stash = stash;
+        table->stash_capacity = capacity;
+    }
+    table->stash[table->stash_count].item = item;
+    table->stash[table->stash_count].hash = hash;
+    table->stash_count++;
+    return 0;
+}
+
+/*
+ * Buckets keep only an 8-bit tag, so resizing calls the hash function again
+ * for every item. The rebuild never fails for lack of room: items that find
+ * no slot in the new arrays go to its stash, whatever its size.
+ */
+static int algokit_hash_ck_resize(algokit_hash_ck *table, size_t bucket_count) {
+    algokit_hash_ck next = *table;
+    size_t i;
+
+    if (algokit_hash_ck_alloc(&next, bucket_count) != 0) {
+        return -1;
+    }
+
+    for (i = 0; i < table->bucket_count * ALGOKIT_HASH_CK_SLOTS; i++) {
+        if (table->tags[i] != 0) {
+            Item item = table->buckets[i / ALGOKIT_HASH_CK_SLOTS].items[i % ALGOKIT_HASH_CK_SLOTS];
+            if (algokit_hash_ck_insert(&next, item, table->hash(item.key), SIZE_MAX) != 0) {
+                algokit_hash_ck_free_arrays(&next);
+                return -1;
+            }
+        }
+    }
+    for (i = 0; i < table->stash_count; i++) {
+        if (algokit_hash_ck_insert(&next, table->stash[i].item, table->stash[i].hash, SIZE_MAX) != 0) {
+            algokit_hash_ck_free_arrays(&next);
+            return -1;
+        }
+    }
+
+    algokit_hash_ck_free_arrays(table);
+    *table = next;
+    return 0;
+}
+
+/* Moves stashed items back into their buckets once a delete frees a slot. */
+static void algokit_hash_ck_drain_stash(algokit_hash_ck *table) {
+    size_t i = 0;
+
+    while (i < table->stash_count) {
+        size_t hash = table->stash[i].hash;
+        size_t first = algokit_hash_ck_index(table, hash);
+        unsigned char tag = algokit_hash_ck_tag(hash);
+
+        if (algokit_hash_ck_take_free(table, first, table->stash[i].item, tag) == 0 ||
+            algokit_hash_ck_take_free(table, algokit_hash_ck_alt(table, first, tag), table->stash[i].item, tag) == 0) {
+            table->stash[i] = table->stash[--table->stash_count];
+        } else {
+            i++;
+        }
+    }
+}
+
+/*
+ * Finds key: returns its slot index (bucket * 4 + slot) through *slot and 0,
+ * its stash index and 2, or 1 if absent.
+ */
+static int algokit_hash_ck_find(const algokit_hash_ck *table, const void *key, size_t hash, size_t *slot) {
+    size_t buckets[2];
+    unsigned char tag = algokit_hash_ck_tag(hash);
+    unsigned b;
+    size_t i;
+
+    buckets[0] = algokit_hash_ck_index(table, hash);
+    buckets[1] = algokit_hash_ck_alt(table, buckets[0], tag);
+    ALGOKIT_HASH_CK_PREFETCH(&table->buckets[buckets[1]]);
+
+    for (b = 0; b < 2; b++) {
+        const unsigned char *tags = &table->tags[buckets[b] * ALGOKIT_HASH_CK_SLOTS];
+        unsigned s;
+
+        for (s = 0; s < ALGOKIT_HASH_CK_SLOTS; s++) {
+            if (tags[s] == tag && table->cmp(table->buckets[buckets[b]].items[s].key, key) == 0) {
+                *slot = buckets[b] * ALGOKIT_HASH_CK_SLOTS + s;
+                return 0;
+            }
+        }
+    }
+
+    for (i = 0; i < table->stash_count; i++) {
+        if (table->stash[i].hash == hash && table->cmp(table->stash[i].item.key, key) == 0) {
+            *slot = i;
+            return 2;
+        }
+    }
+
+    return 1;
+}
+
+algokit_hash_ck *algokit_hash_ck_create(size_t capacity, algokit_key_hash_fn hash, algokit_key_cmp_fn cmp) {
+    algokit_hash_ck *table;
+
+    if (!hash || !cmp || capacity == 0) {
+        return NULL;
+    }
+
+    table = (algokit_hash_ck *)malloc(sizeof(*table));
+    if (!table) {
+        return NULL;
+    }
+
+    if (algokit_hash_ck_alloc(table, algokit_hash_ck_buckets_for(capacity)) != 0) {
+        free(table);
+        return NULL;
+    }
+
+    table->size = 0;
+    table->hash = hash;
+    table->cmp = cmp;
+    return table;
+}
+
+void algokit_hash_ck_destroy(algokit_hash_ck *table, algokit_item_destroy_fn destroy) {
+    size_t i;
+
+    if (!table) {
+        return;
+    }
+
+    for (i = 0; destroy && i < table->bucket_count * ALGOKIT_HASH_CK_SLOTS; i++) {
+        if (table->tags[i] != 0) {
+            Item *item = &table->buckets[i / ALGOKIT_HASH_CK_SLOTS].items[i % ALGOKIT_HASH_CK_SLOTS];
+            destroy(item->key, item->val);
+        }
+    }
+    for (i = 0; destroy && i < table->stash_count; i++) {
+        destroy(table->stash[i].item.key, table->stash[i].item.val);
+    }
+
+    algokit_hash_ck_free_arrays(table);
+    free(table);
+}
+
+int algokit_hash_ck_put(algokit_hash_ck *table, Item item) {
+    size_t hash;
+    size_t slot;
+    int result;
+
+    if (!table) {
+        return -1;
+    }
+
+    hash = table->hash(item.key);
+    if (algokit_hash_ck_find(table, item.key, hash, &slot) != 1) {
+        return 1;
+    }
+
+    /* 4-slot buckets with two choices fill past 95% before inserts fail; growing at 90% keeps BFS paths short. */
+    if ((table->size + 1) * 10 > table->bucket_count * ALGOKIT_HASH_CK_SLOTS * 9) {
+        if (algokit_hash_ck_resize(table, table->bucket_count * 2) != 0) {
+            return -1;
+        }
+    }
+
+    /*
+     * A full stash means the table is too crowded, unless it is less than half
+     * full: then many keys share the same hash and growing would not separate
+     * them, so the stash takes the item instead.
+     */
+    result = algokit_hash_ck_insert(table, item, hash, ALGOKIT_HASH_CK_STASH);
+    if (result == 1 && table->size * 2 < table->bucket_count * ALGOKIT_HASH_CK_SLOTS) {
+        result = algokit_hash_ck_insert(table, item, hash, SIZE_MAX);
+    } else if (result == 1) {
+        if (algokit_hash_ck_resize(table, table->bucket_count * 2) != 0) {
+            return -1;
+        }
+        result = algokit_hash_ck_insert(table, item, hash, SIZE_MAX);
+    }
+    if (result != 0) {
+        return -1;
+    }
+    table->size++;
+    return 0;
+}
+
+int algokit_hash_ck_get(const algokit_hash_ck *table, const void *key, Item *out) {
+    size_t slot;
+    int found;
+
+    if (!table || !key || !out) {
+        return -1;
+    }
+
+    found = algokit_hash_ck_find(table, key, table->hash(key), &slot);
+    if (found == 1) {
+        return 1;
+    }
+
+    *out = found == 2 ? table->stash[slot].item
+                      : table->buckets[slot / ALGOKIT_HASH_CK_SLOTS].items[slot % ALGOKIT_HASH_CK_SLOTS];
+    return 0;
+}
+
+int algokit_hash_ck_delete(algokit_hash_ck *table, const void *key, Item *out) {
+    size_t slot;
+    int found;
+
+    if (!table || !key || !out) {
+        return -1;
+    }
+
+    found = algokit_hash_ck_find(table, key, table->hash(key), &slot);
+    if (found == 1) {
+        return 1;
+    }
+
+    if (found == 2) {
+        *out = table->stash[slot].item;
+        table->stash[slot] = table->stash[--table->stash_count];
+    } else {
+        *out = table->buckets[slot / ALGOKIT_HASH_CK_SLOTS].items[slot % ALGOKIT_HASH_CK_SLOTS];
+        table->tags[slot] = 0;
+        if (table->stash_count > 0) {
+            algokit_hash_ck_drain_stash(table);
+        }
+    }
+    table->size--;
+
+    if (table->bucket_count > ALGOKIT_HASH_CK_MIN_BUCKETS &&
+        table->size * 8 < table->bucket_count * ALGOKIT_HASH_CK_SLOTS) {
+        algokit_hash_ck_resize(table, table->bucket_count / 2);
+    }
+    return 0;
+}
@@ -0,0 +1,405 @@
+#include "algokit/hash_frozen.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Image layout: struct algokit_hash_frozen_header, then bucket_count uint32_t
+ * pilots, then table_size - count uint32_t remap entries, padded to a multiple
+ * of 8 bytes. The frozen table keeps its index in exactly this form, so
+ * lookups on a live table and on a mapped image run the same code.
+ */
+#define ALGOKIT_HASH_FROZEN_MAGIC UINT64_C(0x324E5A4F52464B41) /* "AKFROZN2" */
+#define ALGOKIT_HASH_FROZEN_KEYS_PER_BUCKET 4
+#define ALGOKIT_HASH_FROZEN_DENSE_SHARE UINT64_C(0x9999999999999999) /* 60% of 2^64 */
+
+/*
+ * Keys are placed in table_size = count * 100 / 99 + 1 slots (load 0.99), so
+ * at least 1% of the slots stay free and the last single-key buckets need
+ * at most about 100 pilot tries on average, not about count. Keys that land
+ * past count are moved to the free slots below it through the remap array.
+ */
+#define ALGOKIT_HASH_FROZEN_LOAD_PERCENT 99
+
+struct algokit_hash_frozen_header {
+    uint64_t magic;
+    uint64_t count;
+    uint64_t bucket_count;
+    uint64_t table_size;
+};
+
+struct algokit_hash_frozen {
+    struct algokit_hash_frozen_header *header;
+    uint32_t *pilots;
+    uint32_t *remap;
+    Item *items;
+    algokit_key_hash_fn hash;
+    algokit_key_cmp_fn cmp;
+};
+
+/* One multiply between two xor-shifts: enough to spread pilots and buckets, cheaper than a full finalizer. */
+static uint64_t algokit_hash_frozen_mix(uint64_t x) {
+    x ^= x >> 32;
+    x *= UINT64_C(0x9E3779B97F4A7C15);
+    x ^= x >> 29;
+    return x;
+}
+
+/* Maps the top 32 bits of x onto 0..range-1 with a multiply instead of a division. */
+static uint64_t algokit_hash_frozen_range(uint64_t x, uint64_t range) {
+    return ((x >> 32) * range) >> 32;
+}
+
+/*
+ * Skewed bucket mapping: 60% of the keys go to the first 30% of the buckets.
+ * Those large buckets are placed first, while the table is nearly empty, and
+ * leave the many small buckets for the crowded end of the build.
+ */
+static size_t algokit_hash_frozen_bucket(uint64_t hash, uint64_t bucket_count) {
+    uint64_t x = algokit_hash_frozen_mix(hash);
+    uint64_t dense = (bucket_count * 3 + 9) / 10;
+
+    if (x < ALGOKIT_HASH_FROZEN_DENSE_SHARE || dense == bucket_count) {
+        return (size_t)algokit_hash_frozen_range(x << 32 | x >> 32, dense);
+    }
+    return (size_t)(dense + algokit_hash_frozen_range(x << 32 | x >> 32, bucket_count - dense));
+}
+
+static size_t algokit_hash_frozen_slot(uint64_t hash, uint32_t pilot, uint64_t table_size) {
+    uint64_t h2 = (uint64_t)hash * UINT64_C(0xC2B2AE3D27D4EB4F);
+    return (size_t)algokit_hash_frozen_range(algokit_hash_frozen_mix(h2 ^ (pilot * UINT64_C(0xFF51AFD7ED558CCD))),
+                                             table_size);
+}
+
+/* Pilots and remap entries in 8-byte words, so data stored after the image stays aligned. */
+static size_t algokit_hash_frozen_index_words(uint64_t bucket_count, uint64_t table_size, uint64_t count) {
+    return (size_t)((bucket_count + (table_size - count) + 1) / 2);
+}
+
+/* Finds a pilot that sends every key of one bucket to a distinct free slot. */
+static int algokit_hash_frozen_place(struct algokit_hash_frozen_header *header, unsigned char *taken,
+                                     const uint64_t *hashes, size_t n, size_t *slots, uint32_t *pilot) {
+    uint32_t p = 0;
+
+    do {
+        size_t i;
+        size_t j;
+
+        for (i = 0; i < n; i++) {
+            slots[i] = algokit_hash_frozen_slot(hashes[i], p, header->table_size);
+            if (taken[slots[i]]) {
+                break;
+            }
+            for (j = 0; j < i && slots[j] != slots[i]; j++) {
+            }
+            if (j < i) {
+                break;
+            }
+        }
+        if (i == n) {
+            *pilot = p;
+            return 0;
+        }
+    } while (++p != 0);
+
+    return -1;
+}
+
+/*
+ * Groups keys by bucket with a counting sort: on return the keys of bucket b
+ * are order[start[b]] .. order[start[b + 1] - 1]. Returns the largest bucket size.
+ */
+static size_t algokit_hash_frozen_group(const uint64_t *hashes, size_t count, size_t bucket_count, size_t *start,
+                                        size_t *order) {
+    size_t max_size = 0;
+    size_t i;
+
+    for (i = 0; i < count; i++) {
+        start[algokit_hash_frozen_bucket(hashes[i], bucket_count) + 1]++;
+    }
+    for (i = 0; i < bucket_count; i++) {
+        max_size = start[i + 1] > max_size ? start[i + 1] : max_size;
+        start[i + 1] += start[i];
+    }
+    for (i = 0; i < count; i++) {
+        order[start[algokit_hash_frozen_bucket(hashes[i], bucket_count)]++] = i;
+    }
+    for (i = bucket_count; i > 0; i--) {
+        start[i] = start[i - 1];
+    }
+    start[0] = 0;
+    return max_size;
+}
+
+/*
+ * Builds the pilots: buckets are visited from largest to smallest (counting
+ * sort by size) and each gets the first pilot that fits. The scratch arrays
+ * hold at least count + 2 entries; taken and items hold table_size.
+ */
+static int algokit_hash_frozen_assign(algokit_hash_frozen *frozen, const Item *input, const uint64_t *hashes,
+                                      size_t *start, size_t *order, size_t *by_size, size_t *size_start,
+                                      uint64_t *bucket_hashes, size_t *slots, unsigned char *taken) {
+    size_t count = (size_t)frozen->header->count;
+    size_t bucket_count = (size_t)frozen->header->bucket_count;
+    size_t max_size = algokit_hash_frozen_group(hashes, count, bucket_count, start, order);
+    size_t i;
+
+    for (i = 0; i < bucket_count; i++) {
+        size_start[max_size - (start[i + 1] - start[i]) + 1]++;
+    }
+    for (i = 0; i <= max_size; i++) {
+        size_start[i + 1] += size_start[i];
+    }
+    for (i = 0; i < bucket_count; i++) {
+        by_size[size_start[max_size - (start[i + 1] - start[i])]++] = i;
+    }
+
+    for (i = 0; i < bucket_count; i++) {
+        size_t b = by_size[i];
+        size_t n = start[b + 1] - start[b];
+        size_t j;
+        size_t k;
+
+        frozen->pilots[b] = 0;
+        for (j = 0; j < n; j++) {
+            bucket_hashes[j] = hashes[order[start[b] + j]];
+            /* Equal hashes land in the same slot for every pilot. */
+            for (k = 0; k < j; k++) {
+                if (bucket_hashes[k] == bucket_hashes[j]) {
+                    return -1;
+                }
+            }
+        }
+        if (n == 0) {
+            continue;
+        }
+        if (algokit_hash_frozen_place(frozen->header, taken, bucket_hashes, n, slots, &frozen->pilots[b]) != 0) {
+            return -1;
+        }
+        for (j = 0; j < n; j++) {
+            taken[slots[j]] = 1;
+            frozen->items[slots[j]] = input[order[start[b] + j]];
+        }
+    }
+    return 0;
+}
+
+/*
+ * Moves the keys that landed in slots count..table_size-1 to the free slots
+ * below count, in order; there are exactly as many of each. Unused remap
+ * entries point to slot 0, where a lookup fails the cmp check.
+ */
+static void algokit_hash_frozen_remap(algokit_hash_frozen *frozen, unsigned char *taken) {
+    size_t count = (size_t)frozen->header->count;
+    size_t table_size = (size_t)frozen->header->table_size;
+    size_t free_slot = 0;
+    size_t p;
+
+    for (p = count; p < table_size; p++) {
+        frozen->remap[p - count] = 0;
+        if (taken[p]) {
+            while (taken[free_slot]) {
+                free_slot++;
+            }
+            taken[free_slot] = 1;
+            frozen->items[free_slot] = frozen->items[p];
+            frozen->remap[p - count] = (uint32_t)free_slot;
+        }
+    }
+}
+
+static int algokit_hash_frozen_build(algokit_hash_frozen *frozen, const Item *input, const uint64_t *hashes) {
+    size_t count = (size_t)frozen->header->count;
+    size_t bucket_count = (size_t)frozen->header->bucket_count;
+    size_t *start = (size_t *)calloc(bucket_count + 1, sizeof(size_t));
+    size_t *order = (size_t *)malloc((count + 1) * sizeof(size_t));
+    size_t *by_size = (size_t *)malloc(bucket_count * sizeof(size_t));
+    size_t *size_start = (size_t *)calloc(count + 2, sizeof(size_t));
+    uint64_t *bucket_hashes = (uint64_t *)malloc((count + 1) * sizeof(uint64_t));
+    size_t *slots = (size_t *)malloc((count + 1) * sizeof(size_t));
+    unsigned char *taken = (unsigned char *)calloc((size_t)frozen->header->table_size, 1);
+    int result = -1;
+
+    if (start && order && by_size && size_start && bucket_hashes && slots && taken) {
+        result = algokit_hash_frozen_assign(frozen, input, hashes, start, order, by_size, size_start, bucket_hashes,
+                                            slots, taken);
+    }
+    if (result == 0) {
+        algokit_hash_frozen_remap(frozen, taken);
+    }
+
+    free(start);
+    free(order);
+    free(by_size);
+    free(size_start);
+    free(bucket_hashes);
+    free(slots);
+    free(taken);
+    return result;
+}
+
+algokit_hash_frozen *algokit_hash_freeze(const algokit_hash_lp *table, algokit_key_hash_fn hash, algokit_key_cmp_fn cmp) {
+    algokit_hash_frozen *frozen;
+    algokit_hash_cursor cursor;
+    Item *input = NULL;
+    uint64_t *hashes = NULL;
+    size_t count;
+    size_t bucket_count;
+    size_t table_size;
+    size_t i = 0;
+    Item item;
+    int status;
+    int built = 0;
+
+    if (!table || !hash || !cmp) {
+        return NULL;
+    }
+
+    count = algokit_hash_lp_size(table);
+    if (count > UINT32_MAX) {
+        return NULL;
+    }
+    bucket_count = count / ALGOKIT_HASH_FROZEN_KEYS_PER_BUCKET + 1;
+    table_size = (size_t)((uint64_t)count * 100 / ALGOKIT_HASH_FROZEN_LOAD_PERCENT + 1);
+
+    frozen = (algokit_hash_frozen *)malloc(sizeof(*frozen));
+    if (!frozen) {
+        return NULL;
+    }
+    frozen->header = (struct algokit_hash_frozen_header *)calloc(
+        1, sizeof(*frozen->header) + algokit_hash_frozen_index_words(bucket_count, table_size, count) * sizeof(uint64_t));
+    /* Items past count only hold keys until they are remapped. */
+    frozen->items = (Item *)malloc(table_size * sizeof(Item));
+    input = (Item *)malloc((count + 1) * sizeof(Item));
+    hashes = (uint64_t *)malloc((count + 1) * sizeof(uint64_t));
+
+    if (frozen->header && frozen->items && input && hashes) {
+        frozen->header->magic = ALGOKIT_HASH_FROZEN_MAGIC;
+        frozen->header->count = count;
+        frozen->header->bucket_count = bucket_count;
+        frozen->header->table_size = table_size;
+        frozen->pilots = (uint32_t *)(frozen->header + 1);
+        frozen->remap = frozen->pilots + bucket_count;
+        frozen->hash = hash;
+        frozen->cmp = cmp;
+
+        for (status = algokit_hash_lp_first(table, &cursor, &item); status == 0 && i < count;
+             status = algokit_hash_lp_next(table, &cursor, &item)) {
+            input[i] = item;
+            hashes[i] = (uint64_t)hash(item.key);
+            i++;
+        }
+        if (i == count) {
+            built = algokit_hash_frozen_build(frozen, input, hashes) == 0;
+        }
+    }
+
+    free(input);
+    free(hashes);
+    if (!built) {
+        free(frozen->header);
+        free(frozen->items);
+        free(frozen);
+        return NULL;
+    }
+    return frozen;
+}
+
+void algokit_hash_frozen_destroy(algokit_hash_frozen *frozen, algokit_item_destroy_fn destroy) {
+    size_t i;
+
+    if (!frozen) {
+        return;
+    }
+
+    for (i = 0; destroy && i < frozen->header->count; i++) {
+        destroy(frozen->items[i].key, frozen->items[i].val);
+    }
+
+    free(frozen->header);
+    free(frozen->items);
+    free(frozen);
+}
+
+int algokit_hash_frozen_get(const algokit_hash_frozen *frozen, const void *key, Item *out) {
+    size_t index;
+
+    if (!frozen || !key || !out) {
+        return -1;
+    }
+
+    if (algokit_hash_frozen_image_index(frozen->header, algokit_hash_frozen_image_size(frozen), frozen->hash(key),
+                                        &index) != 0) {
+        return 1;
+    }
+    if (frozen->cmp(frozen->items[index].key, key) != 0) {
+        return 1;
+    }
+
+    *out = frozen->items[index];
+    return 0;
+}
+
+size_t algokit_hash_frozen_size(const algokit_hash_frozen *frozen) {
+    return frozen ? (size_t)frozen->header->count : 0;
+}
+
+int algokit_hash_frozen_item_at(const algokit_hash_frozen *frozen, size_t index, Item *out) {
+    if (!frozen || !out || index >= frozen->header->count) {
+        return -1;
+    }
+
+    *out = frozen->items[index];
+    return 0;
+}
+
+size_t algokit_hash_frozen_image_size(const algokit_hash_frozen *frozen) {
+    if (!frozen) {
+        return 0;
+    }
+    return sizeof(struct algokit_hash_frozen_header) +
+           algokit_hash_frozen_index_words(frozen->header->bucket_count, frozen->header->table_size,
+                                           frozen->header->count) *
+               sizeof(uint64_t);
+}
+
+int algokit_hash_frozen_write_image(const algokit_hash_frozen *frozen, void *buf, size_t size) {
+    if (!frozen || !buf || size < algokit_hash_frozen_image_size(frozen)) {
+        return -1;
+    }
+
+    memcpy(buf, frozen->header, algokit_hash_frozen_image_size(frozen));
+    return 0;
+}
+
+/* Returns 1 for an empty set (no slot exists), -1 for a malformed image. */
+int algokit_hash_frozen_image_index(const void *image, size_t size, size_t hash, size_t *index) {
+    const struct algokit_hash_frozen_header *header = (const struct algokit_hash_frozen_header *)image;
+    const uint32_t *pilots;
+    size_t slot;
+
+    /* Bound each count by size first, so huge header values cannot overflow the padded size check. */
+    if (!image || !index || size < sizeof(*header) || header->magic != ALGOKIT_HASH_FROZEN_MAGIC ||
+        header->bucket_count == 0 || header->table_size < header->count || header->bucket_count > size ||
+        header->table_size - header->count > size ||
+        (size - sizeof(*header)) / sizeof(uint64_t) <
+            algokit_hash_frozen_index_words(header->bucket_count, header->table_size, header->count)) {
+        return -1;
+    }
+    if (header->count == 0) {
+        return 1;
+    }
+
+    pilots = (const uint32_t *)(header + 1);
+    slot = algokit_hash_frozen_slot(hash, pilots[algokit_hash_frozen_bucket(hash, header->bucket_count)],
+                                    header->table_size);
+    if (slot >= header->count) {
+        slot = pilots[header->bucket_count + (slot - header->count)];
+        if (slot >= header->count) {
+            return -1;
+        }
+    }
+    *index = slot;
+    return 0;
+}
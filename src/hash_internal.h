@@ -0,0 +1,20 @@
+#ifndef ALGOKIT_HASH_INTERNAL_H
+#define ALGOKIT_HASH_INTERNAL_H
+
+#include "algokit/hash.h"
+#include "pool.h"
+
+/*
+ * Internal constructors (not part of the public API) for the tables that
+ * keep their nodes in a pool: slab_alloc replaces malloc for that one
+ * table's slabs, e.g. to make slab allocation fail in a test. The public
+ * create functions pass malloc.
+ */
+
+algokit_hash_sc *algokit_hash_sc_create_with(size_t capacity, algokit_key_hash_fn hash, algokit_key_cmp_fn cmp,
+                                             algokit_pool_alloc_fn slab_alloc);
+
+algokit_hash_bc *algokit_hash_bc_create_with(size_t capacity, algokit_key_hash_fn hash, algokit_key_cmp_fn cmp,
+                                             algokit_pool_alloc_fn slab_alloc);
+
+#endif /* ALGOKIT_HASH_INTERNAL_H */
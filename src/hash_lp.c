@@ -1,45 +1,171 @@
 #include "algokit/hash.h"
 
+#include <stdint.h>
 #include <stdlib.h>
 
+/* Old slots scanned per put/delete while an incremental resize is in progress. */
+#define ALGOKIT_HASH_LP_MIGRATE_STEP 16
+
+/* Keys hashed and prefetched together by the batch APIs. */
+#define ALGOKIT_HASH_LP_BATCH 16
+
+#if defined(__GNUC__)
+#define ALGOKIT_HASH_LP_PREFETCH(addr) __builtin_prefetch(addr)
+#else
+#define ALGOKIT_HASH_LP_PREFETCH(addr) ((void)(addr))
+#endif
+
 struct algokit_hash_lp_entry {
     Item item;
+    size_t hash; /* full user hash, reused on resize */
     int state;
 };
 
-struct algokit_hash_lp {
+struct algokit_hash_lp_array {
     struct algokit_hash_lp_entry *entries;
     size_t capacity;
+    unsigned shift;
+};
+
+/*
+ * cur receives every insert. old is non-NULL only while an incremental
+ * resize is draining it; slots before migrate_pos have been moved to cur.
+ * size counts live items in both arrays.
+ */
+struct algokit_hash_lp {
+    struct algokit_hash_lp_array cur;
+    struct algokit_hash_lp_array old;
+    size_t migrate_pos;
     size_t size;
+    size_t grow_count;
+    size_t shrink_count;
+    int incremental;
     algokit_key_hash_fn hash;
     algokit_key_cmp_fn cmp;
 };
 
-static size_t algokit_hash_lp_index(const algokit_hash_lp *table, const void *key) {
-    return table->hash(key) % table->capacity;
+/* Capacities are powers of two (at least 8 slots); returns log2 of the rounded capacity. */
+static unsigned algokit_hash_lp_bits(size_t capacity) {
+    unsigned bits = 3;
+
+    while (((size_t)1 << bits) < capacity) {
+        bits++;
+    }
+    return bits;
+}
+
+/*
+ * Fibonacci hashing: multiply by 2^64/phi and keep the top bits. This spreads
+ * weak user hashes across the table and replaces the division of hash % capacity.
+ */
+static size_t algokit_hash_lp_index(const struct algokit_hash_lp_array *array, size_t hash) {
+    return (size_t)(((uint64_t)hash * UINT64_C(0x9E3779B97F4A7C15)) >> array->shift);
+}
+
+static int algokit_hash_lp_array_alloc(struct algokit_hash_lp_array *array, size_t capacity) {
+    unsigned bits = algokit_hash_lp_bits(capacity);
+
+    array->entries = (struct algokit_hash_lp_entry *)calloc((size_t)1 << bits, sizeof(*array->entries));
+    if (!array->entries) {
+        return -1;
+    }
+
+    array->capacity = (size_t)1 << bits;
+    array->shift = 64u - bits;
+    return 0;
 }
 
-static int algokit_hash_lp_resize(algokit_hash_lp *table, size_t new_capacity) {
+static size_t algokit_hash_lp_find(const algokit_hash_lp *table, const struct algokit_hash_lp_array *array,
+                                   const void *key, size_t hash) {
+    size_t mask = array->capacity - 1;
+    size_t idx = algokit_hash_lp_index(array, hash);
+
+    while (array->entries[idx].state != 0) {
+        if (array->entries[idx].state == 1 && array->entries[idx].hash == hash &&
+            table->cmp(array->entries[idx].item.key, key) == 0) {
+            return idx;
+        }
+        idx = (idx + 1) & mask;
+    }
+
+    return (size_t)-1;
+}
+
+/* The key is known to be absent, so the first empty or tombstone slot on its path is correct. */
+static void algokit_hash_lp_place(struct algokit_hash_lp_array *array, const struct algokit_hash_lp_entry *entry) {
+    size_t mask = array->capacity - 1;
+    size_t idx = algokit_hash_lp_index(array, entry->hash);
+
+    while (array->entries[idx].state == 1) {
+        idx = (idx + 1) & mask;
+    }
+    array->entries[idx] = *entry;
+}
+
+/*
+ * Move up to steps old slots into cur. A moved slot becomes a tombstone so
+ * probe sequences through the old array stay intact for later lookups.
+ */
+static void algokit_hash_lp_migrate(algokit_hash_lp *table, size_t steps) {
+    while (table->old.entries && table->migrate_pos < table->old.capacity && steps > 0) {
+        struct algokit_hash_lp_entry *entry = &table->old.entries[table->migrate_pos++];
+
+        if (entry->state == 1) {
+            algokit_hash_lp_place(&table->cur, entry);
+            entry->state = 2;
+        }
+        steps--;
+    }
+
+    if (table->old.entries && table->migrate_pos == table->old.capacity) {
+        free(table->old.entries);
+        table->old.entries = NULL;
+    }
+}
+
+/* Smallest capacity that holds count items without reaching the 70% growth threshold. */
+static size_t algokit_hash_lp_capacity_for(size_t count) {
+    size_t capacity = 8;
+
+    while (count * 10 >= capacity * 7) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+static int algokit_hash_lp_resize(algokit_hash_lp *table, size_t new_capacity, int incremental) {
+    struct algokit_hash_lp_array next;
     size_t i;
-    struct algokit_hash_lp_entry *old_entries = table->entries;
-    size_t old_capacity = table->capacity;
 
-    table->entries = (struct algokit_hash_lp_entry *)calloc(new_capacity, sizeof(*table->entries));
-    if (!table->entries) {
-        table->entries = old_entries;
+    /* At most one resize is in flight: finish the previous one first. */
+    algokit_hash_lp_migrate(table, (size_t)-1);
+
+    if (algokit_hash_lp_array_alloc(&next, new_capacity) != 0) {
         return -1;
     }
 
-    table->capacity = new_capacity;
-    table->size = 0;
+    if (next.capacity > table->cur.capacity) {
+        table->grow_count++;
+    } else {
+        table->shrink_count++;
+    }
+
+    if (incremental) {
+        table->old = table->cur;
+        table->cur = next;
+        table->migrate_pos = 0;
+        return 0;
+    }
 
-    for (i = 0; i < old_capacity; i++) {
-        if (old_entries[i].state == 1) {
-            algokit_hash_lp_put(table, old_entries[i].item);
+    /* The new array has no tombstones or duplicates: drop each entry into the first empty slot. */
+    for (i = 0; i < table->cur.capacity; i++) {
+        if (table->cur.entries[i].state == 1) {
+            algokit_hash_lp_place(&next, &table->cur.entries[i]);
         }
     }
 
-    free(old_entries);
+    free(table->cur.entries);
+    table->cur = next;
     return 0;
 }
 
@@ -55,14 +181,19 @@ algokit_hash_lp *algokit_hash_lp_create(size_t capacity, algokit_key_hash_fn has
         return NULL;
     }
 
-    table->entries = (struct algokit_hash_lp_entry *)calloc(capacity, sizeof(*table->entries));
-    if (!table->entries) {
+    if (algokit_hash_lp_array_alloc(&table->cur, capacity) != 0) {
         free(table);
         return NULL;
     }
 
-    table->capacity = capacity;
+    table->old.entries = NULL;
+    table->old.capacity = 0;
+    table->old.shift = 0;
+    table->migrate_pos = 0;
     table->size = 0;
+    table->grow_count = 0;
+    table->shrink_count = 0;
+    table->incremental = 0;
     table->hash = hash;
     table->cmp = cmp;
     return table;
@@ -76,91 +207,372 @@ void algokit_hash_lp_destroy(algokit_hash_lp *table, algokit_item_destroy_fn des
     }
 
     if (destroy) {
-        for (i = 0; i < table->capacity; i++) {
-            if (table->entries[i].state == 1) {
-                destroy(table->entries[i].item.key, table->entries[i].item.val);
+        for (i = 0; i < table->cur.capacity; i++) {
+            if (table->cur.entries[i].state == 1) {
+                destroy(table->cur.entries[i].item.key, table->cur.entries[i].item.val);
+            }
+        }
+        for (i = table->migrate_pos; table->old.entries && i < table->old.capacity; i++) {
+            if (table->old.entries[i].state == 1) {
+                destroy(table->old.entries[i].item.key, table->old.entries[i].item.val);
             }
         }
     }
 
-    free(table->entries);
+    free(table->cur.entries);
+    free(table->old.entries);
     free(table);
 }
 
-int algokit_hash_lp_put(algokit_hash_lp *table, Item item) {
-    size_t idx;
-    size_t first_tombstone = (size_t)-1;
-
+int algokit_hash_lp_set_incremental(algokit_hash_lp *table, int enabled) {
     if (!table) {
         return -1;
     }
 
-    if ((table->size + 1) * 10 >= table->capacity * 7) {
-        if (algokit_hash_lp_resize(table, table->capacity * 2) != 0) {
+    if (!enabled) {
+        algokit_hash_lp_migrate(table, (size_t)-1);
+    }
+    table->incremental = enabled != 0;
+    return 0;
+}
+
+static int algokit_hash_lp_put_hashed(algokit_hash_lp *table, Item item, size_t hash) {
+    struct algokit_hash_lp_entry entry;
+
+    algokit_hash_lp_migrate(table, ALGOKIT_HASH_LP_MIGRATE_STEP);
+
+    entry.hash = hash;
+    if (algokit_hash_lp_find(table, &table->cur, item.key, entry.hash) != (size_t)-1 ||
+        (table->old.entries && algokit_hash_lp_find(table, &table->old, item.key, entry.hash) != (size_t)-1)) {
+        return 1;
+    }
+
+    if ((table->size + 1) * 10 >= table->cur.capacity * 7) {
+        if (algokit_hash_lp_resize(table, table->cur.capacity * 2, table->incremental) != 0) {
             return -1;
         }
     }
 
-    idx = algokit_hash_lp_index(table, item.key);
-    while (table->entries[idx].state != 0) {
-        if (table->entries[idx].state == 1 && table->cmp(table->entries[idx].item.key, item.key) == 0) {
-            return 1;
-        }
-        if (table->entries[idx].state == 2 && first_tombstone == (size_t)-1) {
-            first_tombstone = idx;
+    entry.item = item;
+    entry.state = 1;
+    algokit_hash_lp_place(&table->cur, &entry);
+    table->size++;
+    return 0;
+}
+
+static int algokit_hash_lp_get_hashed(const algokit_hash_lp *table, const void *key, size_t hash, Item *out) {
+    size_t idx;
+
+    idx = algokit_hash_lp_find(table, &table->cur, key, hash);
+    if (idx != (size_t)-1) {
+        *out = table->cur.entries[idx].item;
+        return 0;
+    }
+
+    if (table->old.entries) {
+        idx = algokit_hash_lp_find(table, &table->old, key, hash);
+        if (idx != (size_t)-1) {
+            *out = table->old.entries[idx].item;
+            return 0;
         }
-        idx = (idx + 1) % table->capacity;
     }
 
-    if (first_tombstone != (size_t)-1) {
-        idx = first_tombstone;
+    return 1;
+}
+
+int algokit_hash_lp_put(algokit_hash_lp *table, Item item) {
+    if (!table) {
+        return -1;
     }
 
-    table->entries[idx].item = item;
-    table->entries[idx].state = 1;
-    table->size++;
-    return 0;
+    return algokit_hash_lp_put_hashed(table, item, table->hash(item.key));
 }
 
 int algokit_hash_lp_get(const algokit_hash_lp *table, const void *key, Item *out) {
-    size_t idx;
+    if (!table || !key || !out) {
+        return -1;
+    }
+
+    return algokit_hash_lp_get_hashed(table, key, table->hash(key), out);
+}
 
+int algokit_hash_lp_put_with_hash(algokit_hash_lp *table, Item item, size_t hash) {
+    if (!table) {
+        return -1;
+    }
+
+    return algokit_hash_lp_put_hashed(table, item, hash);
+}
+
+int algokit_hash_lp_get_with_hash(const algokit_hash_lp *table, const void *key, size_t hash, Item *out) {
     if (!table || !key || !out) {
         return -1;
     }
 
-    idx = algokit_hash_lp_index(table, key);
-    while (table->entries[idx].state != 0) {
-        if (table->entries[idx].state == 1 && table->cmp(table->entries[idx].item.key, key) == 0) {
-            *out = table->entries[idx].item;
-            return 0;
+    return algokit_hash_lp_get_hashed(table, key, hash, out);
+}
+
+/*
+ * Batches run in two passes over groups of ALGOKIT_HASH_LP_BATCH keys: the
+ * first hashes every key and prefetches its home slot, the second resolves
+ * the probes. The cache misses of one group then overlap instead of
+ * stalling one after another.
+ */
+int algokit_hash_lp_get_batch(const algokit_hash_lp *table, const void *const *keys, size_t count, Item *out, int *results) {
+    size_t hashes[ALGOKIT_HASH_LP_BATCH];
+    size_t base;
+    size_t i;
+    int rc = 0;
+
+    if (!table || (count > 0 && (!keys || !out || !results))) {
+        return -1;
+    }
+
+    for (base = 0; base < count; base += ALGOKIT_HASH_LP_BATCH) {
+        size_t n = count - base < ALGOKIT_HASH_LP_BATCH ? count - base : ALGOKIT_HASH_LP_BATCH;
+
+        for (i = 0; i < n; i++) {
+            hashes[i] = keys[base + i] ? table->hash(keys[base + i]) : 0;
+            ALGOKIT_HASH_LP_PREFETCH(&table->cur.entries[algokit_hash_lp_index(&table->cur, hashes[i])]);
+        }
+        for (i = 0; i < n; i++) {
+            if (!keys[base + i]) {
+                results[base + i] = -1;
+                rc = -1;
+                continue;
+            }
+            results[base + i] = algokit_hash_lp_get_hashed(table, keys[base + i], hashes[i], &out[base + i]);
         }
-        idx = (idx + 1) % table->capacity;
     }
 
-    return 1;
+    return rc;
 }
 
-int algokit_hash_lp_delete(algokit_hash_lp *table, const void *key, Item *out) {
+int algokit_hash_lp_put_batch(algokit_hash_lp *table, const Item *items, size_t count, int *results) {
+    size_t hashes[ALGOKIT_HASH_LP_BATCH];
+    size_t base;
+    size_t i;
+    int rc = 0;
+
+    if (!table || (count > 0 && (!items || !results))) {
+        return -1;
+    }
+
+    for (base = 0; base < count; base += ALGOKIT_HASH_LP_BATCH) {
+        size_t n = count - base < ALGOKIT_HASH_LP_BATCH ? count - base : ALGOKIT_HASH_LP_BATCH;
+
+        /* A resize inside the group only makes some prefetches useless; each put recomputes its slot. */
+        for (i = 0; i < n; i++) {
+            hashes[i] = table->hash(items[base + i].key);
+            ALGOKIT_HASH_LP_PREFETCH(&table->cur.entries[algokit_hash_lp_index(&table->cur, hashes[i])]);
+        }
+        for (i = 0; i < n; i++) {
+            results[base + i] = algokit_hash_lp_put_hashed(table, items[base + i], hashes[i]);
+            if (results[base + i] < 0) {
+                rc = -1;
+            }
+        }
+    }
+
+    return rc;
+}
+
+static int algokit_hash_lp_delete_hashed(algokit_hash_lp *table, const void *key, size_t hash, Item *out) {
+    struct algokit_hash_lp_array *array;
     size_t idx;
 
+    algokit_hash_lp_migrate(table, ALGOKIT_HASH_LP_MIGRATE_STEP);
+
+    array = &table->cur;
+    idx = algokit_hash_lp_find(table, array, key, hash);
+    if (idx == (size_t)-1 && table->old.entries) {
+        array = &table->old;
+        idx = algokit_hash_lp_find(table, array, key, hash);
+    }
+    if (idx == (size_t)-1) {
+        return 1;
+    }
+
+    *out = array->entries[idx].item;
+    array->entries[idx].state = 2;
+    table->size--;
+
+    /* In incremental mode, wait for the running migration before starting a shrink. */
+    if (table->cur.capacity > 8 && table->size * 10 <= table->cur.capacity * 2 && !table->old.entries) {
+        algokit_hash_lp_resize(table, table->cur.capacity / 2, table->incremental);
+    }
+    return 0;
+}
+
+int algokit_hash_lp_delete(algokit_hash_lp *table, const void *key, Item *out) {
     if (!table || !key || !out) {
         return -1;
     }
 
-    idx = algokit_hash_lp_index(table, key);
-    while (table->entries[idx].state != 0) {
-        if (table->entries[idx].state == 1 && table->cmp(table->entries[idx].item.key, key) == 0) {
-            *out = table->entries[idx].item;
-            table->entries[idx].state = 2;
-            table->size--;
-            if (table->capacity > 8 && table->size * 10 <= table->capacity * 2) {
-                algokit_hash_lp_resize(table, table->capacity / 2);
-            }
+    return algokit_hash_lp_delete_hashed(table, key, table->hash(key), out);
+}
+
+int algokit_hash_lp_delete_with_hash(algokit_hash_lp *table, const void *key, size_t hash, Item *out) {
+    if (!table || !key || !out) {
+        return -1;
+    }
+
+    return algokit_hash_lp_delete_hashed(table, key, hash, out);
+}
+
+size_t algokit_hash_lp_size(const algokit_hash_lp *table) {
+    if (!table) {
+        return 0;
+    }
+
+    return table->size;
+}
+
+/* Adds the tombstones and probe lengths of one array; distances wrap around the end of the array. */
+static void algokit_hash_lp_array_stats(const struct algokit_hash_lp_array *array, algokit_hash_stats *out,
+                                        double *probe_sum) {
+    size_t mask = array->capacity - 1;
+    size_t i;
+
+    for (i = 0; i < array->capacity; i++) {
+        const struct algokit_hash_lp_entry *entry = &array->entries[i];
+        size_t probe;
+
+        if (entry->state == 2) {
+            out->tombstones++;
+        }
+        if (entry->state != 1) {
+            continue;
+        }
+
+        probe = ((i - algokit_hash_lp_index(array, entry->hash)) & mask) + 1;
+        *probe_sum += (double)probe;
+        if (probe > out->max_probe) {
+            out->max_probe = probe;
+        }
+        out->probe_histogram[probe < ALGOKIT_HASH_STATS_HISTOGRAM ? probe - 1 : ALGOKIT_HASH_STATS_HISTOGRAM - 1]++;
+    }
+}
+
+int algokit_hash_lp_stats(const algokit_hash_lp *table, algokit_hash_stats *out) {
+    double probe_sum = 0.0;
+    size_t i;
+
+    if (!table || !out) {
+        return -1;
+    }
+
+    out->size = table->size;
+    out->capacity = table->cur.capacity;
+    out->load_factor = (double)table->size / (double)table->cur.capacity;
+    out->tombstones = 0;
+    out->max_probe = 0;
+    for (i = 0; i < ALGOKIT_HASH_STATS_HISTOGRAM; i++) {
+        out->probe_histogram[i] = 0;
+    }
+
+    /* During an incremental resize the old array's items and tombstones still cost lookups. */
+    algokit_hash_lp_array_stats(&table->cur, out, &probe_sum);
+    if (table->old.entries) {
+        algokit_hash_lp_array_stats(&table->old, out, &probe_sum);
+    }
+
+    out->avg_probe = table->size > 0 ? probe_sum / (double)table->size : 0.0;
+    out->grow_count = table->grow_count;
+    out->shrink_count = table->shrink_count;
+    return 0;
+}
+
+size_t algokit_hash_lp_capacity(const algokit_hash_lp *table) {
+    if (!table) {
+        return 0;
+    }
+
+    return table->cur.capacity;
+}
+
+/*
+ * Cursor positions run over the current array, then over the old array of a
+ * pending incremental resize. Migrated old slots are tombstones, so no item
+ * is visited twice.
+ */
+int algokit_hash_lp_first(const algokit_hash_lp *table, algokit_hash_cursor *cursor, Item *out) {
+    if (!cursor) {
+        return -1;
+    }
+
+    cursor->index = 0;
+    cursor->node = NULL;
+    return algokit_hash_lp_next(table, cursor, out);
+}
+
+int algokit_hash_lp_next(const algokit_hash_lp *table, algokit_hash_cursor *cursor, Item *out) {
+    size_t total;
+
+    if (!table || !cursor || !out) {
+        return -1;
+    }
+
+    total = table->cur.capacity + (table->old.entries ? table->old.capacity : 0);
+    while (cursor->index < total) {
+        const struct algokit_hash_lp_entry *entry = cursor->index < table->cur.capacity
+                                                        ? &table->cur.entries[cursor->index]
+                                                        : &table->old.entries[cursor->index - table->cur.capacity];
+
+        cursor->index++;
+        if (entry->state == 1) {
+            *out = entry->item;
             return 0;
         }
-        idx = (idx + 1) % table->capacity;
     }
 
     return 1;
 }
+
+int algokit_hash_lp_reserve(algokit_hash_lp *table, size_t count) {
+    size_t capacity;
+
+    if (!table) {
+        return -1;
+    }
+
+    capacity = algokit_hash_lp_capacity_for(count);
+    if (capacity <= table->cur.capacity) {
+        return 0;
+    }
+
+    return algokit_hash_lp_resize(table, capacity, 0);
+}
+
+int algokit_hash_lp_shrink_to_fit(algokit_hash_lp *table) {
+    if (!table) {
+        return -1;
+    }
+
+    /* Always rebuild, even at the same capacity: the new array has no tombstones. */
+    return algokit_hash_lp_resize(table, algokit_hash_lp_capacity_for(table->size), 0);
+}
+
+void algokit_hash_lp_clear(algokit_hash_lp *table, algokit_item_destroy_fn destroy) {
+    size_t i;
+
+    if (!table) {
+        return;
+    }
+
+    /* Entries not yet migrated are still live in old; drop them rather than rehashing them into cur. */
+    for (i = table->migrate_pos; destroy && table->old.entries && i < table->old.capacity; i++) {
+        if (table->old.entries[i].state == 1) {
+            destroy(table->old.entries[i].item.key, table->old.entries[i].item.val);
+        }
+    }
+    free(table->old.entries);
+    table->old.entries = NULL;
+    for (i = 0; i < table->cur.capacity; i++) {
+        if (destroy && table->cur.entries[i].state == 1) {
+            destroy(table->cur.entries[i].item.key, table->cur.entries[i].item.val);
+        }
+        table->cur.entries[i].state = 0;
+    }
+    table->size = 0;
+}
@@ -0,0 +1,236 @@
+#include "algokit/hash_region.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "algokit/key.h"
+
+/*
+ * Region layout (all offsets from the start of the region):
+ *   struct algokit_hash_region          header
+ *   struct algokit_hash_region_slot[n]  n = slot_count, a power of two
+ *   data area                           key and value bytes, 8-byte aligned
+ * A slot with key_off == 0 is empty: no key can start inside the header.
+ */
+#define ALGOKIT_HASH_REGION_MAGIC UINT64_C(0x314E4F4947524B41) /* "AKRGION1" */
+#define ALGOKIT_HASH_REGION_ALIGN 8
+/* find result for a slot whose offsets leave the data area, or a probe that found no empty slot. */
+#define ALGOKIT_HASH_REGION_CORRUPT ((size_t)-1)
+
+struct algokit_hash_region_slot {
+    uint64_t hash;
+    uint64_t key_off;
+    uint64_t val_off;
+    uint32_t key_len;
+    uint32_t val_len;
+};
+
+struct algokit_hash_region {
+    uint64_t magic;
+    uint64_t size;
+    uint64_t slot_count;
+    uint64_t shift;
+    uint64_t count;
+    uint64_t data_used;
+    uint64_t sealed;
+};
+
+static size_t algokit_hash_region_align(size_t n) {
+    return (n + ALGOKIT_HASH_REGION_ALIGN - 1) & ~(size_t)(ALGOKIT_HASH_REGION_ALIGN - 1);
+}
+
+/* Smallest power of two with capacity at no more than 3/4 of the slots. */
+static size_t algokit_hash_region_slots_for(size_t capacity) {
+    size_t slots = 8;
+
+    while (slots * 3 < capacity * 4) {
+        slots *= 2;
+    }
+    return slots;
+}
+
+static struct algokit_hash_region_slot *algokit_hash_region_slots(const algokit_hash_region *region) {
+    return (struct algokit_hash_region_slot *)(uintptr_t)(region + 1);
+}
+
+static size_t algokit_hash_region_data_start(size_t slot_count) {
+    return sizeof(struct algokit_hash_region) + slot_count * sizeof(struct algokit_hash_region_slot);
+}
+
+static size_t algokit_hash_region_index(const algokit_hash_region *region, uint64_t hash) {
+    return (size_t)((hash * UINT64_C(0x9E3779B97F4A7C15)) >> region->shift);
+}
+
+/* Key and value bytes must lie between the end of the slots and data_used. */
+static int algokit_hash_region_slot_ok(const algokit_hash_region *region, const struct algokit_hash_region_slot *slot) {
+    uint64_t start = algokit_hash_region_data_start((size_t)region->slot_count);
+    uint64_t end = region->data_used;
+
+    return slot->key_off >= start && slot->key_off <= end && slot->key_len <= end - slot->key_off &&
+           slot->val_off >= start && slot->val_off <= end && slot->val_len <= end - slot->val_off;
+}
+
+/*
+ * Returns the slot holding the key, or the empty slot where it would go.
+ * Readers may map bytes they did not write, so a candidate slot is bounds
+ * checked before its key is read and the probe stops after one full lap.
+ */
+static size_t algokit_hash_region_find(const algokit_hash_region *region, const void *key, size_t key_len,
+                                       uint64_t hash) {
+    const struct algokit_hash_region_slot *slots = algokit_hash_region_slots(region);
+    const unsigned char *base = (const unsigned char *)region;
+    size_t mask = (size_t)region->slot_count - 1;
+    size_t idx = algokit_hash_region_index(region, hash);
+    size_t probes;
+
+    for (probes = 0; probes < (size_t)region->slot_count; probes++) {
+        const struct algokit_hash_region_slot *slot = &slots[idx];
+        if (slot->key_off == 0) {
+            return idx;
+        }
+        if (slot->hash == hash && slot->key_len == key_len) {
+            if (!algokit_hash_region_slot_ok(region, slot)) {
+                return ALGOKIT_HASH_REGION_CORRUPT;
+            }
+            if (key_len == 0 || memcmp(base + slot->key_off, key, key_len) == 0) {
+                return idx;
+            }
+        }
+        idx = (idx + 1) & mask;
+    }
+    return ALGOKIT_HASH_REGION_CORRUPT;
+}
+
+size_t algokit_hash_region_bytes(size_t capacity, size_t data_bytes) {
+    if (capacity == 0) {
+        return 0;
+    }
+    return algokit_hash_region_data_start(algokit_hash_region_slots_for(capacity)) +
+           algokit_hash_region_align(data_bytes);
+}
+
+algokit_hash_region *algokit_hash_region_init(void *base, size_t size, size_t capacity) {
+    algokit_hash_region *region = (algokit_hash_region *)base;
+    size_t slot_count;
+
+    if (!base || capacity == 0 || ((uintptr_t)base & (ALGOKIT_HASH_REGION_ALIGN - 1)) != 0) {
+        return NULL;
+    }
+
+    slot_count = algokit_hash_region_slots_for(capacity);
+    if (size < algokit_hash_region_data_start(slot_count)) {
+        return NULL;
+    }
+
+    memset(base, 0, algokit_hash_region_data_start(slot_count));
+    region->magic = ALGOKIT_HASH_REGION_MAGIC;
+    region->size = size;
+    region->slot_count = slot_count;
+    region->shift = 64;
+    while (((uint64_t)1 << (64 - region->shift)) < slot_count) {
+        region->shift--;
+    }
+    region->count = 0;
+    region->data_used = algokit_hash_region_data_start(slot_count);
+    region->sealed = 0;
+    return region;
+}
+
+int algokit_hash_region_put(algokit_hash_region *region, const void *key, size_t key_len, const void *val,
+                            size_t val_len) {
+    struct algokit_hash_region_slot *slot;
+    unsigned char *base = (unsigned char *)region;
+    uint64_t hash;
+    size_t key_off;
+    size_t val_off;
+    size_t idx;
+
+    if (!region || region->sealed || (!key && key_len > 0) || (!val && val_len > 0) || key_len > UINT32_MAX ||
+        val_len > UINT32_MAX) {
+        return -1;
+    }
+
+    hash = algokit_key_hash_bytes(key, key_len, 0);
+    idx = algokit_hash_region_find(region, key, key_len, hash);
+    if (idx == ALGOKIT_HASH_REGION_CORRUPT) {
+        return -1;
+    }
+    slot = &algokit_hash_region_slots(region)[idx];
+    if (slot->key_off != 0) {
+        return 1;
+    }
+
+    /* The slot count is fixed, and so is the data area: a full region rejects the put. */
+    key_off = (size_t)region->data_used;
+    val_off = algokit_hash_region_align(key_off + key_len);
+    if ((region->count + 1) * 4 > region->slot_count * 3 || val_off + val_len > region->size) {
+        return -1;
+    }
+
+    if (key_len > 0) {
+        memcpy(base + key_off, key, key_len);
+    }
+    if (val_len > 0) {
+        memcpy(base + val_off, val, val_len);
+    }
+    slot->hash = hash;
+    slot->key_off = key_off;
+    slot->val_off = val_off;
+    slot->key_len = (uint32_t)key_len;
+    slot->val_len = (uint32_t)val_len;
+    region->data_used = algokit_hash_region_align(val_off + val_len);
+    region->count++;
+    return 0;
+}
+
+int algokit_hash_region_seal(algokit_hash_region *region) {
+    if (!region || region->magic != ALGOKIT_HASH_REGION_MAGIC) {
+        return -1;
+    }
+
+    region->sealed = 1;
+    return 0;
+}
+
+const algokit_hash_region *algokit_hash_region_open(const void *base, size_t size) {
+    const algokit_hash_region *region = (const algokit_hash_region *)base;
+
+    if (!base || ((uintptr_t)base & (ALGOKIT_HASH_REGION_ALIGN - 1)) != 0 || size < sizeof(*region)) {
+        return NULL;
+    }
+    if (region->magic != ALGOKIT_HASH_REGION_MAGIC || !region->sealed || region->size > size ||
+        region->shift == 0 || region->shift > 61 || region->slot_count != (uint64_t)1 << (64 - region->shift) ||
+        region->slot_count > (size - sizeof(*region)) / sizeof(struct algokit_hash_region_slot) ||
+        region->data_used < algokit_hash_region_data_start((size_t)region->slot_count) ||
+        region->data_used > region->size || region->count > region->slot_count) {
+        return NULL;
+    }
+    return region;
+}
+
+int algokit_hash_region_get(const algokit_hash_region *region, const void *key, size_t key_len, const void **val,
+                            size_t *val_len) {
+    const struct algokit_hash_region_slot *slot;
+    size_t idx;
+
+    if (!region || (!key && key_len > 0) || !val || !val_len) {
+        return -1;
+    }
+
+    idx = algokit_hash_region_find(region, key, key_len, algokit_key_hash_bytes(key, key_len, 0));
+    if (idx == ALGOKIT_HASH_REGION_CORRUPT) {
+        return -1;
+    }
+    slot = &algokit_hash_region_slots(region)[idx];
+    if (slot->key_off == 0) {
+        return 1;
+    }
+
+    *val = (const unsigned char *)region + slot->val_off;
+    *val_len = slot->val_len;
+    return 0;
+}
+
+size_t algokit_hash_region_count(const algokit_hash_region *region) {
+    return region ? (size_t)region->count : 0;
+}
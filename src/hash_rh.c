@@ -0,0 +1,230 @@
+#include "algokit/hash.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define ALGOKIT_HASH_RH_MIN_CAPACITY 16
+
+/*
+ * dist is the probe distance plus one, so 0 marks an empty slot.
+ * The user hash is cached so resizing never calls the hash function again.
+ */
+struct algokit_hash_rh_entry {
+    Item item;
+    size_t hash;
+    size_t dist;
+};
+
+struct algokit_hash_rh {
+    struct algokit_hash_rh_entry *entries;
+    size_t capacity;
+    size_t size;
+    unsigned shift;
+    algokit_key_hash_fn hash;
+    algokit_key_cmp_fn cmp;
+};
+
+/* Fibonacci hashing: the top bits of hash * 2^64/phi select the home slot. */
+static size_t algokit_hash_rh_home(const algokit_hash_rh *table, size_t hash) {
+    return (size_t)(((uint64_t)hash * UINT64_C(0x9E3779B97F4A7C15)) >> table->shift);
+}
+
+static int algokit_hash_rh_alloc(algokit_hash_rh *table, size_t capacity) {
+    unsigned bits = 0;
+
+    while (((size_t)1 << bits) < capacity) {
+        bits++;
+    }
+
+    table->entries = (struct algokit_hash_rh_entry *)calloc((size_t)1 << bits, sizeof(*table->entries));
+    if (!table->entries) {
+        return -1;
+    }
+
+    table->capacity = (size_t)1 << bits;
+    table->shift = 64u - bits;
+    table->size = 0;
+    return 0;
+}
+
+/* Robin Hood insertion: an entry further from home takes the slot of a richer one. */
+static void algokit_hash_rh_insert(algokit_hash_rh *table, struct algokit_hash_rh_entry cur) {
+    size_t mask = table->capacity - 1;
+    size_t idx = algokit_hash_rh_home(table, cur.hash);
+
+    cur.dist = 1;
+    while (table->entries[idx].dist != 0) {
+        if (table->entries[idx].dist < cur.dist) {
+            struct algokit_hash_rh_entry tmp = table->entries[idx];
+            table->entries[idx] = cur;
+            cur = tmp;
+        }
+        idx = (idx + 1) & mask;
+        cur.dist++;
+    }
+
+    table->entries[idx] = cur;
+    table->size++;
+}
+
+static int algokit_hash_rh_resize(algokit_hash_rh *table, size_t new_capacity) {
+    struct algokit_hash_rh_entry *old_entries = table->entries;
+    size_t old_capacity = table->capacity;
+    size_t old_size = table->size;
+    unsigned old_shift = table->shift;
+    size_t i;
+
+    if (algokit_hash_rh_alloc(table, new_capacity) != 0) {
+        table->entries = old_entries;
+        table->capacity = old_capacity;
+        table->size = old_size;
+        table->shift = old_shift;
+        return -1;
+    }
+
+    for (i = 0; i < old_capacity; i++) {
+        if (old_entries[i].dist != 0) {
+            algokit_hash_rh_insert(table, old_entries[i]);
+        }
+    }
+
+    free(old_entries);
+    return 0;
+}
+
+/*
+ * A lookup stops as soon as it meets a slot closer to its home than the
+ * probe is: Robin Hood ordering guarantees the key would have been there.
+ */
+static size_t algokit_hash_rh_find(const algokit_hash_rh *table, const void *key, size_t hash) {
+    size_t mask = table->capacity - 1;
+    size_t idx = algokit_hash_rh_home(table, hash);
+    size_t dist = 1;
+
+    while (table->entries[idx].dist >= dist) {
+        if (table->entries[idx].hash == hash && table->cmp(table->entries[idx].item.key, key) == 0) {
+            return idx;
+        }
+        idx = (idx + 1) & mask;
+        dist++;
+    }
+
+    return (size_t)-1;
+}
+
+algokit_hash_rh *algokit_hash_rh_create(size_t capacity, algokit_key_hash_fn hash, algokit_key_cmp_fn cmp) {
+    algokit_hash_rh *table;
+
+    if (!hash || !cmp || capacity == 0) {
+        return NULL;
+    }
+
+    table = (algokit_hash_rh *)malloc(sizeof(*table));
+    if (!table) {
+        return NULL;
+    }
+
+    if (algokit_hash_rh_alloc(table, capacity < ALGOKIT_HASH_RH_MIN_CAPACITY ? ALGOKIT_HASH_RH_MIN_CAPACITY : capacity) != 0) {
+        free(table);
+        return NULL;
+    }
+
+    table->hash = hash;
+    table->cmp = cmp;
+    return table;
+}
+
+void algokit_hash_rh_destroy(algokit_hash_rh *table, algokit_item_destroy_fn destroy) {
+    size_t i;
+
+    if (!table) {
+        return;
+    }
+
+    if (destroy) {
+        for (i = 0; i < table->capacity; i++) {
+            if (table->entries[i].dist != 0) {
+                destroy(table->entries[i].item.key, table->entries[i].item.val);
+            }
+        }
+    }
+
+    free(table->entries);
+    free(table);
+}
+
+int algokit_hash_rh_put(algokit_hash_rh *table, Item item) {
+    struct algokit_hash_rh_entry entry;
+
+    if (!table) {
+        return -1;
+    }
+
+    entry.hash = table->hash(item.key);
+    if (algokit_hash_rh_find(table, item.key, entry.hash) != (size_t)-1) {
+        return 1;
+    }
+
+    /* Grow at 7/8 load; the new table starts at 7/16. */
+    if ((table->size + 1) * 8 > table->capacity * 7) {
+        if (algokit_hash_rh_resize(table, table->capacity * 2) != 0) {
+            return -1;
+        }
+    }
+
+    entry.item = item;
+    entry.dist = 0;
+    algokit_hash_rh_insert(table, entry);
+    return 0;
+}
+
+int algokit_hash_rh_get(const algokit_hash_rh *table, const void *key, Item *out) {
+    size_t idx;
+
+    if (!table || !key || !out) {
+        return -1;
+    }
+
+    idx = algokit_hash_rh_find(table, key, table->hash(key));
+    if (idx == (size_t)-1) {
+        return 1;
+    }
+
+    *out = table->entries[idx].item;
+    return 0;
+}
+
+int algokit_hash_rh_delete(algokit_hash_rh *table, const void *key, Item *out) {
+    size_t mask;
+    size_t idx;
+    size_t next;
+
+    if (!table || !key || !out) {
+        return -1;
+    }
+
+    idx = algokit_hash_rh_find(table, key, table->hash(key));
+    if (idx == (size_t)-1) {
+        return 1;
+    }
+
+    *out = table->entries[idx].item;
+
+    /* Backward shift: pull the following displaced entries one slot closer to home. */
+    mask = table->capacity - 1;
+    next = (idx + 1) & mask;
+    while (table->entries[next].dist > 1) {
+        table->entries[idx] = table->entries[next];
+        table->entries[idx].dist--;
+        idx = next;
+        next = (next + 1) & mask;
+    }
+    table->entries[idx].dist = 0;
+    table->size--;
+
+    /* Shrink below 1/8 load; the new table starts under 1/4, far from the grow point. */
+    if (table->capacity > ALGOKIT_HASH_RH_MIN_CAPACITY && table->size * 8 < table->capacity) {
+        algokit_hash_rh_resize(table, table->capacity / 2);
+    }
+    return 0;
+}
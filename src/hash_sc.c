@@ -1,9 +1,26 @@
 #include "algokit/hash.h"
 
+#include <stdint.h>
 #include <stdlib.h>
 
+#include "hash_internal.h"
+#include "pool.h"
+
+/* Nodes carved per slab: 256 nodes of 32 bytes make an 8 KiB slab on 64-bit targets. */
+#define ALGOKIT_HASH_SC_NODES_PER_SLAB 256
+
+/* Keys hashed and prefetched together by the batch APIs. */
+#define ALGOKIT_HASH_SC_BATCH 16
+
+#if defined(__GNUC__)
+#define ALGOKIT_HASH_SC_PREFETCH(addr) __builtin_prefetch(addr)
+#else
+#define ALGOKIT_HASH_SC_PREFETCH(addr) ((void)(addr))
+#endif
+
 struct algokit_hash_sc_node {
     Item item;
+    size_t hash; /* full user hash; picks the bucket on relink */
     struct algokit_hash_sc_node *next;
 };
 
@@ -11,20 +28,40 @@ struct algokit_hash_sc {
     struct algokit_hash_sc_node **buckets;
     size_t capacity;
     size_t size;
+    size_t grow_count;
+    size_t shrink_count;
+    unsigned shift;
+    struct algokit_pool pool;
     algokit_key_hash_fn hash;
     algokit_key_cmp_fn cmp;
 };
 
-static size_t algokit_hash_sc_index(const algokit_hash_sc *table, const void *key) {
-    return table->hash(key) % table->capacity;
+/* Capacities are powers of two (at least 8 slots); returns log2 of the rounded capacity. */
+static unsigned algokit_hash_sc_bits(size_t capacity) {
+    unsigned bits = 3;
+
+    while (((size_t)1 << bits) < capacity) {
+        bits++;
+    }
+    return bits;
 }
 
-static struct algokit_hash_sc_node *algokit_hash_sc_node_create(Item item) {
-    struct algokit_hash_sc_node *node = (struct algokit_hash_sc_node *)malloc(sizeof(*node));
+/* Fibonacci hashing: multiply by 2^64/phi and keep the top bits as the bucket. */
+static size_t algokit_hash_sc_slot(size_t hash, unsigned shift) {
+    return (size_t)(((uint64_t)hash * UINT64_C(0x9E3779B97F4A7C15)) >> shift);
+}
+
+static size_t algokit_hash_sc_index(const algokit_hash_sc *table, size_t hash) {
+    return algokit_hash_sc_slot(hash, table->shift);
+}
+
+static struct algokit_hash_sc_node *algokit_hash_sc_node_create(algokit_hash_sc *table, Item item, size_t hash) {
+    struct algokit_hash_sc_node *node = (struct algokit_hash_sc_node *)algokit_pool_alloc(&table->pool);
     if (!node) {
         return NULL;
     }
     node->item = item;
+    node->hash = hash;
     node->next = NULL;
     return node;
 }
@@ -33,23 +70,30 @@ static int algokit_hash_sc_resize(algokit_hash_sc *table, size_t new_capacity) {
     size_t i;
     struct algokit_hash_sc_node **old_buckets = table->buckets;
     size_t old_capacity = table->capacity;
+    unsigned bits = algokit_hash_sc_bits(new_capacity);
 
-    table->buckets = (struct algokit_hash_sc_node **)calloc(new_capacity, sizeof(*table->buckets));
+    table->buckets = (struct algokit_hash_sc_node **)calloc((size_t)1 << bits, sizeof(*table->buckets));
     if (!table->buckets) {
         table->buckets = old_buckets;
         return -1;
     }
 
-    table->capacity = new_capacity;
-    table->size = 0;
+    if (((size_t)1 << bits) > old_capacity) {
+        table->grow_count++;
+    } else {
+        table->shrink_count++;
+    }
+    table->capacity = (size_t)1 << bits;
+    table->shift = 64u - bits;
 
+    /* Relink the existing nodes using their cached hashes; nothing is reallocated. */
     for (i = 0; i < old_capacity; i++) {
         struct algokit_hash_sc_node *node = old_buckets[i];
         while (node) {
             struct algokit_hash_sc_node *next = node->next;
-            node->next = NULL;
-            algokit_hash_sc_put(table, node->item);
-            free(node);
+            size_t idx = algokit_hash_sc_index(table, node->hash);
+            node->next = table->buckets[idx];
+            table->buckets[idx] = node;
             node = next;
         }
     }
@@ -58,8 +102,10 @@ static int algokit_hash_sc_resize(algokit_hash_sc *table, size_t new_capacity) {
     return 0;
 }
 
-algokit_hash_sc *algokit_hash_sc_create(size_t capacity, algokit_key_hash_fn hash, algokit_key_cmp_fn cmp) {
+algokit_hash_sc *algokit_hash_sc_create_with(size_t capacity, algokit_key_hash_fn hash, algokit_key_cmp_fn cmp,
+                                             algokit_pool_alloc_fn slab_alloc) {
     algokit_hash_sc *table;
+    unsigned bits;
 
     if (!hash || !cmp || capacity == 0) {
         return NULL;
@@ -70,19 +116,29 @@ algokit_hash_sc *algokit_hash_sc_create(size_t capacity, algokit_key_hash_fn has
         return NULL;
     }
 
-    table->buckets = (struct algokit_hash_sc_node **)calloc(capacity, sizeof(*table->buckets));
+    bits = algokit_hash_sc_bits(capacity);
+    table->buckets = (struct algokit_hash_sc_node **)calloc((size_t)1 << bits, sizeof(*table->buckets));
     if (!table->buckets) {
         free(table);
         return NULL;
     }
 
-    table->capacity = capacity;
+    table->capacity = (size_t)1 << bits;
+    table->shift = 64u - bits;
     table->size = 0;
+    table->grow_count = 0;
+    table->shrink_count = 0;
+    algokit_pool_init_with(&table->pool, sizeof(struct algokit_hash_sc_node), ALGOKIT_HASH_SC_NODES_PER_SLAB, 0,
+                           slab_alloc);
     table->hash = hash;
     table->cmp = cmp;
     return table;
 }
 
+algokit_hash_sc *algokit_hash_sc_create(size_t capacity, algokit_key_hash_fn hash, algokit_key_cmp_fn cmp) {
+    return algokit_hash_sc_create_with(capacity, hash, cmp, malloc);
+}
+
 void algokit_hash_sc_destroy(algokit_hash_sc *table, algokit_item_destroy_fn destroy) {
     size_t i;
 
@@ -90,46 +146,40 @@ void algokit_hash_sc_destroy(algokit_hash_sc *table, algokit_item_destroy_fn des
         return;
     }
 
-    for (i = 0; i < table->capacity; i++) {
+    /* Nodes live in the pool, so only the items need a walk. */
+    for (i = 0; destroy && i < table->capacity; i++) {
         struct algokit_hash_sc_node *node = table->buckets[i];
         while (node) {
-            struct algokit_hash_sc_node *next = node->next;
-            if (destroy) {
-                destroy(node->item.key, node->item.val);
-            }
-            free(node);
-            node = next;
+            destroy(node->item.key, node->item.val);
+            node = node->next;
         }
     }
 
+    algokit_pool_release(&table->pool);
     free(table->buckets);
     free(table);
 }
 
-int algokit_hash_sc_put(algokit_hash_sc *table, Item item) {
+static int algokit_hash_sc_put_hashed(algokit_hash_sc *table, Item item, size_t hash) {
     size_t idx;
     struct algokit_hash_sc_node *node;
 
-    if (!table) {
-        return -1;
-    }
-
     if ((table->size + 1) > table->capacity * 2) {
         if (algokit_hash_sc_resize(table, table->capacity * 2) != 0) {
             return -1;
         }
     }
 
-    idx = algokit_hash_sc_index(table, item.key);
+    idx = algokit_hash_sc_index(table, hash);
     node = table->buckets[idx];
     while (node) {
-        if (table->cmp(node->item.key, item.key) == 0) {
+        if (node->hash == hash && table->cmp(node->item.key, item.key) == 0) {
             return 1;
         }
         node = node->next;
     }
 
-    node = algokit_hash_sc_node_create(item);
+    node = algokit_hash_sc_node_create(table, item, hash);
     if (!node) {
         return -1;
     }
@@ -140,18 +190,10 @@ int algokit_hash_sc_put(algokit_hash_sc *table, Item item) {
     return 0;
 }
 
-int algokit_hash_sc_get(const algokit_hash_sc *table, const void *key, Item *out) {
-    size_t idx;
-    struct algokit_hash_sc_node *node;
-
-    if (!table || !key || !out) {
-        return -1;
-    }
-
-    idx = algokit_hash_sc_index(table, key);
-    node = table->buckets[idx];
+static int algokit_hash_sc_get_from(const algokit_hash_sc *table, const struct algokit_hash_sc_node *node,
+                                    const void *key, size_t hash, Item *out) {
     while (node) {
-        if (table->cmp(node->item.key, key) == 0) {
+        if (node->hash == hash && table->cmp(node->item.key, key) == 0) {
             *out = node->item;
             return 0;
         }
@@ -161,26 +203,128 @@ int algokit_hash_sc_get(const algokit_hash_sc *table, const void *key, Item *out
     return 1;
 }
 
-int algokit_hash_sc_delete(algokit_hash_sc *table, const void *key, Item *out) {
-    size_t idx;
-    struct algokit_hash_sc_node *node;
-    struct algokit_hash_sc_node *prev = NULL;
+int algokit_hash_sc_put(algokit_hash_sc *table, Item item) {
+    if (!table) {
+        return -1;
+    }
+
+    return algokit_hash_sc_put_hashed(table, item, table->hash(item.key));
+}
+
+int algokit_hash_sc_get(const algokit_hash_sc *table, const void *key, Item *out) {
+    size_t hash;
 
     if (!table || !key || !out) {
         return -1;
     }
 
-    idx = algokit_hash_sc_index(table, key);
+    hash = table->hash(key);
+    return algokit_hash_sc_get_from(table, table->buckets[algokit_hash_sc_index(table, hash)], key, hash, out);
+}
+
+int algokit_hash_sc_put_with_hash(algokit_hash_sc *table, Item item, size_t hash) {
+    if (!table) {
+        return -1;
+    }
+
+    return algokit_hash_sc_put_hashed(table, item, hash);
+}
+
+int algokit_hash_sc_get_with_hash(const algokit_hash_sc *table, const void *key, size_t hash, Item *out) {
+    if (!table || !key || !out) {
+        return -1;
+    }
+
+    return algokit_hash_sc_get_from(table, table->buckets[algokit_hash_sc_index(table, hash)], key, hash, out);
+}
+
+/*
+ * Batches run over groups of ALGOKIT_HASH_SC_BATCH keys in three passes:
+ * hash and prefetch the bucket heads, load the heads and prefetch the first
+ * nodes, then walk the chains. Each pass overlaps the cache misses of the
+ * whole group.
+ */
+int algokit_hash_sc_get_batch(const algokit_hash_sc *table, const void *const *keys, size_t count, Item *out, int *results) {
+    size_t hashes[ALGOKIT_HASH_SC_BATCH];
+    const struct algokit_hash_sc_node *heads[ALGOKIT_HASH_SC_BATCH];
+    size_t base;
+    size_t i;
+    int rc = 0;
+
+    if (!table || (count > 0 && (!keys || !out || !results))) {
+        return -1;
+    }
+
+    for (base = 0; base < count; base += ALGOKIT_HASH_SC_BATCH) {
+        size_t n = count - base < ALGOKIT_HASH_SC_BATCH ? count - base : ALGOKIT_HASH_SC_BATCH;
+
+        for (i = 0; i < n; i++) {
+            hashes[i] = keys[base + i] ? table->hash(keys[base + i]) : 0;
+            ALGOKIT_HASH_SC_PREFETCH(&table->buckets[algokit_hash_sc_index(table, hashes[i])]);
+        }
+        for (i = 0; i < n; i++) {
+            heads[i] = table->buckets[algokit_hash_sc_index(table, hashes[i])];
+            if (heads[i]) {
+                ALGOKIT_HASH_SC_PREFETCH(heads[i]);
+            }
+        }
+        for (i = 0; i < n; i++) {
+            if (!keys[base + i]) {
+                results[base + i] = -1;
+                rc = -1;
+                continue;
+            }
+            results[base + i] = algokit_hash_sc_get_from(table, heads[i], keys[base + i], hashes[i], &out[base + i]);
+        }
+    }
+
+    return rc;
+}
+
+int algokit_hash_sc_put_batch(algokit_hash_sc *table, const Item *items, size_t count, int *results) {
+    size_t hashes[ALGOKIT_HASH_SC_BATCH];
+    size_t base;
+    size_t i;
+    int rc = 0;
+
+    if (!table || (count > 0 && (!items || !results))) {
+        return -1;
+    }
+
+    for (base = 0; base < count; base += ALGOKIT_HASH_SC_BATCH) {
+        size_t n = count - base < ALGOKIT_HASH_SC_BATCH ? count - base : ALGOKIT_HASH_SC_BATCH;
+
+        /* A resize inside the group only makes some prefetches useless; each put recomputes its bucket. */
+        for (i = 0; i < n; i++) {
+            hashes[i] = table->hash(items[base + i].key);
+            ALGOKIT_HASH_SC_PREFETCH(&table->buckets[algokit_hash_sc_index(table, hashes[i])]);
+        }
+        for (i = 0; i < n; i++) {
+            results[base + i] = algokit_hash_sc_put_hashed(table, items[base + i], hashes[i]);
+            if (results[base + i] < 0) {
+                rc = -1;
+            }
+        }
+    }
+
+    return rc;
+}
+
+static int algokit_hash_sc_delete_hashed(algokit_hash_sc *table, const void *key, size_t hash, Item *out) {
+    size_t idx = algokit_hash_sc_index(table, hash);
+    struct algokit_hash_sc_node *node;
+    struct algokit_hash_sc_node *prev = NULL;
+
     node = table->buckets[idx];
     while (node) {
-        if (table->cmp(node->item.key, key) == 0) {
+        if (node->hash == hash && table->cmp(node->item.key, key) == 0) {
             if (prev) {
                 prev->next = node->next;
             } else {
                 table->buckets[idx] = node->next;
             }
             *out = node->item;
-            free(node);
+            algokit_pool_free(&table->pool, node);
             table->size--;
             if (table->capacity > 8 && table->size < table->capacity / 4) {
                 algokit_hash_sc_resize(table, table->capacity / 2);
@@ -193,3 +337,212 @@ int algokit_hash_sc_delete(algokit_hash_sc *table, const void *key, Item *out) {
 
     return 1;
 }
+
+int algokit_hash_sc_delete(algokit_hash_sc *table, const void *key, Item *out) {
+    if (!table || !key || !out) {
+        return -1;
+    }
+
+    return algokit_hash_sc_delete_hashed(table, key, table->hash(key), out);
+}
+
+int algokit_hash_sc_delete_with_hash(algokit_hash_sc *table, const void *key, size_t hash, Item *out) {
+    if (!table || !key || !out) {
+        return -1;
+    }
+
+    return algokit_hash_sc_delete_hashed(table, key, hash, out);
+}
+
+size_t algokit_hash_sc_size(const algokit_hash_sc *table) {
+    if (!table) {
+        return 0;
+    }
+
+    return table->size;
+}
+
+size_t algokit_hash_sc_capacity(const algokit_hash_sc *table) {
+    if (!table) {
+        return 0;
+    }
+
+    return table->capacity;
+}
+
+int algokit_hash_sc_stats(const algokit_hash_sc *table, algokit_hash_stats *out) {
+    double probe_sum = 0.0;
+    size_t i;
+
+    if (!table || !out) {
+        return -1;
+    }
+
+    out->size = table->size;
+    out->capacity = table->capacity;
+    out->load_factor = (double)table->size / (double)table->capacity;
+    out->tombstones = 0;
+    out->max_probe = 0;
+    for (i = 0; i < ALGOKIT_HASH_STATS_HISTOGRAM; i++) {
+        out->probe_histogram[i] = 0;
+    }
+
+    /* The k-th node of a chain takes k node visits to find. */
+    for (i = 0; i < table->capacity; i++) {
+        const struct algokit_hash_sc_node *node;
+        size_t probe = 0;
+
+        for (node = table->buckets[i]; node; node = node->next) {
+            probe++;
+            probe_sum += (double)probe;
+            out->probe_histogram[probe < ALGOKIT_HASH_STATS_HISTOGRAM ? probe - 1 : ALGOKIT_HASH_STATS_HISTOGRAM - 1]++;
+        }
+        if (probe > out->max_probe) {
+            out->max_probe = probe;
+        }
+    }
+
+    out->avg_probe = table->size > 0 ? probe_sum / (double)table->size : 0.0;
+    out->grow_count = table->grow_count;
+    out->shrink_count = table->shrink_count;
+    return 0;
+}
+
+/* Smallest bucket count that holds count items without reaching the growth threshold of 2 per bucket. */
+static size_t algokit_hash_sc_capacity_for(size_t count) {
+    size_t capacity = 8;
+
+    while (count > capacity * 2) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+/* cursor->node is the node returned last; cursor->index is the next bucket to scan. */
+int algokit_hash_sc_first(const algokit_hash_sc *table, algokit_hash_cursor *cursor, Item *out) {
+    if (!cursor) {
+        return -1;
+    }
+
+    cursor->index = 0;
+    cursor->node = NULL;
+    return algokit_hash_sc_next(table, cursor, out);
+}
+
+int algokit_hash_sc_next(const algokit_hash_sc *table, algokit_hash_cursor *cursor, Item *out) {
+    const struct algokit_hash_sc_node *node;
+
+    if (!table || !cursor || !out) {
+        return -1;
+    }
+
+    node = cursor->node ? ((const struct algokit_hash_sc_node *)cursor->node)->next : NULL;
+    while (!node && cursor->index < table->capacity) {
+        node = table->buckets[cursor->index++];
+    }
+
+    cursor->node = node;
+    if (!node) {
+        return 1;
+    }
+
+    *out = node->item;
+    return 0;
+}
+
+int algokit_hash_sc_reserve(algokit_hash_sc *table, size_t count) {
+    size_t capacity;
+
+    if (!table) {
+        return -1;
+    }
+
+    capacity = algokit_hash_sc_capacity_for(count);
+    if (capacity <= table->capacity) {
+        return 0;
+    }
+
+    return algokit_hash_sc_resize(table, capacity);
+}
+
+/*
+ * Deleted nodes stay in the pool's free list, so besides shrinking the
+ * bucket array this copies the live nodes into a fresh pool and releases the
+ * old slabs. Nothing changes if an allocation fails.
+ */
+int algokit_hash_sc_shrink_to_fit(algokit_hash_sc *table) {
+    struct algokit_hash_sc_node **buckets;
+    struct algokit_pool pool;
+    size_t capacity;
+    unsigned bits;
+    unsigned shift;
+    size_t i;
+
+    if (!table) {
+        return -1;
+    }
+
+    capacity = algokit_hash_sc_capacity_for(table->size);
+    /* Already minimal, and the pool holds no freed node or spare slab to give back. */
+    if (capacity >= table->capacity && !table->pool.free_list && !table->pool.spare) {
+        return 0;
+    }
+    if (capacity > table->capacity) {
+        capacity = table->capacity;
+    }
+
+    bits = algokit_hash_sc_bits(capacity);
+    shift = 64u - bits;
+    buckets = (struct algokit_hash_sc_node **)calloc((size_t)1 << bits, sizeof(*buckets));
+    if (!buckets) {
+        return -1;
+    }
+    algokit_pool_init_with(&pool, sizeof(struct algokit_hash_sc_node), ALGOKIT_HASH_SC_NODES_PER_SLAB, 0,
+                           table->pool.slab_alloc);
+
+    for (i = 0; i < table->capacity; i++) {
+        const struct algokit_hash_sc_node *node;
+        for (node = table->buckets[i]; node; node = node->next) {
+            struct algokit_hash_sc_node *copy = (struct algokit_hash_sc_node *)algokit_pool_alloc(&pool);
+            size_t idx = algokit_hash_sc_slot(node->hash, shift);
+            if (!copy) {
+                algokit_pool_release(&pool);
+                free(buckets);
+                return -1;
+            }
+            *copy = *node;
+            copy->next = buckets[idx];
+            buckets[idx] = copy;
+        }
+    }
+
+    table->shrink_count++;
+    algokit_pool_release(&table->pool);
+    free(table->buckets);
+    table->pool = pool;
+    table->buckets = buckets;
+    table->capacity = (size_t)1 << bits;
+    table->shift = shift;
+    return 0;
+}
+
+void algokit_hash_sc_clear(algokit_hash_sc *table, algokit_item_destroy_fn destroy) {
+    size_t i;
+
+    if (!table) {
+        return;
+    }
+
+    for (i = 0; i < table->capacity; i++) {
+        struct algokit_hash_sc_node *node = table->buckets[i];
+        while (destroy && node) {
+            destroy(node->item.key, node->item.val);
+            node = node->next;
+        }
+        table->buckets[i] = NULL;
+    }
+
+    /* Every node is gone: keep the slabs so the next puts carve them again without malloc. */
+    algokit_pool_reset(&table->pool);
+    table->size = 0;
+}
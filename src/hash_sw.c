@@ -0,0 +1,305 @@
+#include "algokit/hash.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/*
+ * Control bytes: one per slot, stored apart from the Items.
+ * FULL slots hold the top 7 bits of the mixed hash (0..127); EMPTY and
+ * DELETED have the sign bit set so they never match a tag.
+ */
+#define ALGOKIT_HASH_SW_GROUP 16
+#define ALGOKIT_HASH_SW_EMPTY ((signed char)-128)
+#define ALGOKIT_HASH_SW_DELETED ((signed char)-2)
+
+struct algokit_hash_sw {
+    signed char *ctrl;
+    Item *entries;
+    size_t capacity;
+    size_t size;
+    size_t deleted;
+    algokit_key_hash_fn hash;
+    algokit_key_cmp_fn cmp;
+};
+
+static uint64_t algokit_hash_sw_mix(size_t hash) {
+    uint64_t x = (uint64_t)hash;
+    x ^= x >> 32;
+    x *= UINT64_C(0x9E3779B97F4A7C15);
+    x ^= x >> 29;
+    return x;
+}
+
+static signed char algokit_hash_sw_tag(uint64_t mixed) {
+    return (signed char)(mixed >> 57);
+}
+
+static unsigned algokit_hash_sw_lowest_bit(unsigned mask) {
+#if defined(__GNUC__)
+    return (unsigned)__builtin_ctz(mask);
+#else
+    unsigned i = 0;
+    while (!(mask & 1u)) {
+        mask >>= 1;
+        i++;
+    }
+    return i;
+#endif
+}
+
+/* Bit i of the result is set when ctrl[i] == tag. */
+static unsigned algokit_hash_sw_match(const signed char *ctrl, signed char tag) {
+#if defined(__SSE2__)
+    __m128i group = _mm_loadu_si128((const __m128i *)(const void *)ctrl);
+    return (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(tag)));
+#else
+    unsigned mask = 0;
+    unsigned i;
+    for (i = 0; i < ALGOKIT_HASH_SW_GROUP; i++) {
+        mask |= (unsigned)(ctrl[i] == tag) << i;
+    }
+    return mask;
+#endif
+}
+
+/* Bit i of the result is set when ctrl[i] is EMPTY or DELETED. */
+static unsigned algokit_hash_sw_match_free(const signed char *ctrl) {
+#if defined(__SSE2__)
+    __m128i group = _mm_loadu_si128((const __m128i *)(const void *)ctrl);
+    return (unsigned)_mm_movemask_epi8(group);
+#else
+    unsigned mask = 0;
+    unsigned i;
+    for (i = 0; i < ALGOKIT_HASH_SW_GROUP; i++) {
+        mask |= (unsigned)(ctrl[i] < 0) << i;
+    }
+    return mask;
+#endif
+}
+
+static size_t algokit_hash_sw_round_capacity(size_t capacity) {
+    size_t rounded = ALGOKIT_HASH_SW_GROUP;
+
+    while (rounded < capacity) {
+        rounded *= 2;
+    }
+    return rounded;
+}
+
+/*
+ * Probe groups in triangular order (g, g+1, g+3, g+6, ...), which visits every
+ * group once when the group count is a power of two.
+ */
+static size_t algokit_hash_sw_find(const algokit_hash_sw *table, const void *key, uint64_t mixed) {
+    size_t mask = table->capacity / ALGOKIT_HASH_SW_GROUP - 1;
+    size_t group = (size_t)mixed & mask;
+    signed char tag = algokit_hash_sw_tag(mixed);
+    size_t step = 0;
+
+    while (1) {
+        const signed char *ctrl = table->ctrl + group * ALGOKIT_HASH_SW_GROUP;
+        unsigned match = algokit_hash_sw_match(ctrl, tag);
+
+        while (match) {
+            size_t idx = group * ALGOKIT_HASH_SW_GROUP + algokit_hash_sw_lowest_bit(match);
+            if (table->cmp(table->entries[idx].key, key) == 0) {
+                return idx;
+            }
+            match &= match - 1;
+        }
+        if (algokit_hash_sw_match(ctrl, ALGOKIT_HASH_SW_EMPTY)) {
+            return (size_t)-1;
+        }
+        if (++step > mask) {
+            return (size_t)-1;
+        }
+        group = (group + step) & mask;
+    }
+}
+
+static size_t algokit_hash_sw_find_free(const algokit_hash_sw *table, uint64_t mixed) {
+    size_t mask = table->capacity / ALGOKIT_HASH_SW_GROUP - 1;
+    size_t group = (size_t)mixed & mask;
+    size_t step = 0;
+
+    while (1) {
+        unsigned free_mask = algokit_hash_sw_match_free(table->ctrl + group * ALGOKIT_HASH_SW_GROUP);
+        if (free_mask) {
+            return group * ALGOKIT_HASH_SW_GROUP + algokit_hash_sw_lowest_bit(free_mask);
+        }
+        step++;
+        group = (group + step) & mask;
+    }
+}
+
+static int algokit_hash_sw_alloc(algokit_hash_sw *table, size_t capacity) {
+    table->ctrl = (signed char *)malloc(capacity);
+    table->entries = (Item *)malloc(capacity * sizeof(*table->entries));
+    if (!table->ctrl || !table->entries) {
+        free(table->ctrl);
+        free(table->entries);
+        return -1;
+    }
+
+    memset(table->ctrl, ALGOKIT_HASH_SW_EMPTY, capacity);
+    table->capacity = capacity;
+    table->size = 0;
+    table->deleted = 0;
+    return 0;
+}
+
+static int algokit_hash_sw_resize(algokit_hash_sw *table, size_t new_capacity) {
+    signed char *old_ctrl = table->ctrl;
+    Item *old_entries = table->entries;
+    size_t old_capacity = table->capacity;
+    size_t old_size = table->size;
+    size_t old_deleted = table->deleted;
+    size_t i;
+
+    if (algokit_hash_sw_alloc(table, new_capacity) != 0) {
+        table->ctrl = old_ctrl;
+        table->entries = old_entries;
+        table->capacity = old_capacity;
+        table->size = old_size;
+        table->deleted = old_deleted;
+        return -1;
+    }
+
+    for (i = 0; i < old_capacity; i++) {
+        if (old_ctrl[i] >= 0) {
+            uint64_t mixed = algokit_hash_sw_mix(table->hash(old_entries[i].key));
+            size_t idx = algokit_hash_sw_find_free(table, mixed);
+            table->ctrl[idx] = algokit_hash_sw_tag(mixed);
+            table->entries[idx] = old_entries[i];
+            table->size++;
+        }
+    }
+
+    free(old_ctrl);
+    free(old_entries);
+    return 0;
+}
+
+algokit_hash_sw *algokit_hash_sw_create(size_t capacity, algokit_key_hash_fn hash, algokit_key_cmp_fn cmp) {
+    algokit_hash_sw *table;
+
+    if (!hash || !cmp || capacity == 0) {
+        return NULL;
+    }
+
+    table = (algokit_hash_sw *)malloc(sizeof(*table));
+    if (!table) {
+        return NULL;
+    }
+
+    if (algokit_hash_sw_alloc(table, algokit_hash_sw_round_capacity(capacity)) != 0) {
+        free(table);
+        return NULL;
+    }
+
+    table->hash = hash;
+    table->cmp = cmp;
+    return table;
+}
+
+void algokit_hash_sw_destroy(algokit_hash_sw *table, algokit_item_destroy_fn destroy) {
+    size_t i;
+
+    if (!table) {
+        return;
+    }
+
+    if (destroy) {
+        for (i = 0; i < table->capacity; i++) {
+            if (table->ctrl[i] >= 0) {
+                destroy(table->entries[i].key, table->entries[i].val);
+            }
+        }
+    }
+
+    free(table->ctrl);
+    free(table->entries);
+    free(table);
+}
+
+int algokit_hash_sw_put(algokit_hash_sw *table, Item item) {
+    uint64_t mixed;
+    size_t idx;
+
+    if (!table) {
+        return -1;
+    }
+
+    mixed = algokit_hash_sw_mix(table->hash(item.key));
+    if (algokit_hash_sw_find(table, item.key, mixed) != (size_t)-1) {
+        return 1;
+    }
+
+    /* Keep at least 1/8 of the slots EMPTY; purge tombstones before growing. */
+    if ((table->size + table->deleted + 1) * 8 > table->capacity * 7) {
+        size_t new_capacity = (table->size + 1) * 16 > table->capacity * 7 ? table->capacity * 2 : table->capacity;
+        if (algokit_hash_sw_resize(table, new_capacity) != 0) {
+            return -1;
+        }
+    }
+
+    idx = algokit_hash_sw_find_free(table, mixed);
+    if (table->ctrl[idx] == ALGOKIT_HASH_SW_DELETED) {
+        table->deleted--;
+    }
+    table->ctrl[idx] = algokit_hash_sw_tag(mixed);
+    table->entries[idx] = item;
+    table->size++;
+    return 0;
+}
+
+int algokit_hash_sw_get(const algokit_hash_sw *table, const void *key, Item *out) {
+    size_t idx;
+
+    if (!table || !key || !out) {
+        return -1;
+    }
+
+    idx = algokit_hash_sw_find(table, key, algokit_hash_sw_mix(table->hash(key)));
+    if (idx == (size_t)-1) {
+        return 1;
+    }
+
+    *out = table->entries[idx];
+    return 0;
+}
+
+int algokit_hash_sw_delete(algokit_hash_sw *table, const void *key, Item *out) {
+    size_t idx;
+    size_t group_start;
+
+    if (!table || !key || !out) {
+        return -1;
+    }
+
+    idx = algokit_hash_sw_find(table, key, algokit_hash_sw_mix(table->hash(key)));
+    if (idx == (size_t)-1) {
+        return 1;
+    }
+
+    *out = table->entries[idx];
+    table->size--;
+
+    /*
+     * A group that still has an EMPTY slot never stopped a probe sequence,
+     * so the slot can become EMPTY again instead of leaving a tombstone.
+     */
+    group_start = idx - idx % ALGOKIT_HASH_SW_GROUP;
+    if (algokit_hash_sw_match(table->ctrl + group_start, ALGOKIT_HASH_SW_EMPTY)) {
+        table->ctrl[idx] = ALGOKIT_HASH_SW_EMPTY;
+    } else {
+        table->ctrl[idx] = ALGOKIT_HASH_SW_DELETED;
+        table->deleted++;
+    }
+    return 0;
+}
@@ -0,0 +1,231 @@
+#include "algokit/hash_u64.h"
+
+#include <stdlib.h>
+
+#define ALGOKIT_HASH_U64_EMPTY 0
+
+struct algokit_hash_u64_slot {
+    uint64_t key;
+    uint64_t val;
+};
+
+struct algokit_hash_u64 {
+    struct algokit_hash_u64_slot *slots;
+    size_t capacity;
+    size_t size;
+    unsigned shift;
+    int has_zero;
+    uint64_t zero_val;
+};
+
+static unsigned algokit_hash_u64_bits(size_t capacity) {
+    unsigned bits = 3;
+
+    while (((size_t)1 << bits) < capacity) {
+        bits++;
+    }
+    return bits;
+}
+
+static size_t algokit_hash_u64_index(const algokit_hash_u64 *map, uint64_t key) {
+    return (size_t)((key * UINT64_C(0x9E3779B97F4A7C15)) >> map->shift);
+}
+
+static int algokit_hash_u64_alloc(algokit_hash_u64 *map, size_t capacity) {
+    unsigned bits = algokit_hash_u64_bits(capacity);
+    struct algokit_hash_u64_slot *slots =
+        (struct algokit_hash_u64_slot *)calloc((size_t)1 << bits, sizeof(*slots));
+
+    if (!slots) {
+        return -1;
+    }
+
+    map->slots = slots;
+    map->capacity = (size_t)1 << bits;
+    map->shift = 64u - bits;
+    return 0;
+}
+
+/* Returns the slot holding key, or the empty slot where it would go. */
+static size_t algokit_hash_u64_find(const algokit_hash_u64 *map, uint64_t key) {
+    size_t mask = map->capacity - 1;
+    size_t idx = algokit_hash_u64_index(map, key);
+
+    while (map->slots[idx].key != key && map->slots[idx].key != ALGOKIT_HASH_U64_EMPTY) {
+        idx = (idx + 1) & mask;
+    }
+    return idx;
+}
+
+static int algokit_hash_u64_resize(algokit_hash_u64 *map, size_t new_capacity) {
+    struct algokit_hash_u64_slot *old_slots = map->slots;
+    size_t old_capacity = map->capacity;
+    unsigned old_shift = map->shift;
+    size_t i;
+
+    if (algokit_hash_u64_alloc(map, new_capacity) != 0) {
+        map->slots = old_slots;
+        map->capacity = old_capacity;
+        map->shift = old_shift;
+        return -1;
+    }
+
+    for (i = 0; i < old_capacity; i++) {
+        if (old_slots[i].key != ALGOKIT_HASH_U64_EMPTY) {
+            map->slots[algokit_hash_u64_find(map, old_slots[i].key)] = old_slots[i];
+        }
+    }
+
+    free(old_slots);
+    return 0;
+}
+
+algokit_hash_u64 *algokit_hash_u64_create(size_t capacity) {
+    algokit_hash_u64 *map;
+
+    if (capacity == 0) {
+        return NULL;
+    }
+
+    map = (algokit_hash_u64 *)malloc(sizeof(*map));
+    if (!map) {
+        return NULL;
+    }
+
+    if (algokit_hash_u64_alloc(map, capacity) != 0) {
+        free(map);
+        return NULL;
+    }
+
+    map->size = 0;
+    map->has_zero = 0;
+    map->zero_val = 0;
+    return map;
+}
+
+void algokit_hash_u64_destroy(algokit_hash_u64 *map) {
+    if (!map) {
+        return;
+    }
+
+    free(map->slots);
+    free(map);
+}
+
+int algokit_hash_u64_put(algokit_hash_u64 *map, uint64_t key, uint64_t val) {
+    size_t idx;
+
+    if (!map) {
+        return -1;
+    }
+
+    if (key == ALGOKIT_HASH_U64_EMPTY) {
+        if (map->has_zero) {
+            return 1;
+        }
+        map->has_zero = 1;
+        map->zero_val = val;
+        map->size++;
+        return 0;
+    }
+
+    idx = algokit_hash_u64_find(map, key);
+    if (map->slots[idx].key == key) {
+        return 1;
+    }
+
+    /* The zero key is not in the array, so size may overstate the load by one. */
+    if ((map->size + 1) * 4 > map->capacity * 3) {
+        if (algokit_hash_u64_resize(map, map->capacity * 2) != 0) {
+            return -1;
+        }
+        idx = algokit_hash_u64_find(map, key);
+    }
+
+    map->slots[idx].key = key;
+    map->slots[idx].val = val;
+    map->size++;
+    return 0;
+}
+
+int algokit_hash_u64_get(const algokit_hash_u64 *map, uint64_t key, uint64_t *out) {
+    size_t idx;
+
+    if (!map || !out) {
+        return -1;
+    }
+
+    if (key == ALGOKIT_HASH_U64_EMPTY) {
+        if (!map->has_zero) {
+            return 1;
+        }
+        *out = map->zero_val;
+        return 0;
+    }
+
+    idx = algokit_hash_u64_find(map, key);
+    if (map->slots[idx].key != key) {
+        return 1;
+    }
+
+    *out = map->slots[idx].val;
+    return 0;
+}
+
+int algokit_hash_u64_delete(algokit_hash_u64 *map, uint64_t key, uint64_t *out) {
+    size_t mask;
+    size_t hole;
+    size_t idx;
+
+    if (!map || !out) {
+        return -1;
+    }
+
+    if (key == ALGOKIT_HASH_U64_EMPTY) {
+        if (!map->has_zero) {
+            return 1;
+        }
+        *out = map->zero_val;
+        map->has_zero = 0;
+        map->size--;
+        return 0;
+    }
+
+    hole = algokit_hash_u64_find(map, key);
+    if (map->slots[hole].key != key) {
+        return 1;
+    }
+    *out = map->slots[hole].val;
+
+    /*
+     * Backward shift: walk the run after the hole and move back every entry
+     * whose home slot is not between the hole and its current slot (cyclically),
+     * so no lookup ever stops early at the hole.
+     */
+    mask = map->capacity - 1;
+    idx = hole;
+    for (;;) {
+        size_t home;
+
+        idx = (idx + 1) & mask;
+        if (map->slots[idx].key == ALGOKIT_HASH_U64_EMPTY) {
+            break;
+        }
+        home = algokit_hash_u64_index(map, map->slots[idx].key);
+        if (((idx - home) & mask) >= ((idx - hole) & mask)) {
+            map->slots[hole] = map->slots[idx];
+            hole = idx;
+        }
+    }
+    map->slots[hole].key = ALGOKIT_HASH_U64_EMPTY;
+    map->size--;
+
+    if (map->capacity > 8 && map->size * 8 < map->capacity) {
+        algokit_hash_u64_resize(map, map->capacity / 2);
+    }
+    return 0;
+}
+
+size_t algokit_hash_u64_size(const algokit_hash_u64 *map) {
+    return map ? map->size : 0;
+}
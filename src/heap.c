@@ -7,10 +7,11 @@ struct algokit_heap {
     size_t size;
     size_t capacity;
     algokit_key_cmp_fn cmp;
+    int min;
 };
 
 static int algokit_heap_cmp(const algokit_heap *heap, const Item *a, const Item *b) {
-    return heap->cmp(a->key, b->key);
+    return heap->min ? heap->cmp(b->key, a->key) : heap->cmp(a->key, b->key);
 }
 
 static void algokit_heap_swap(Item *a, Item *b) {
@@ -65,7 +66,7 @@ static int algokit_heap_grow(algokit_heap *heap) {
     return 0;
 }
 
-algokit_heap *algokit_heap_create(size_t capacity, algokit_key_cmp_fn cmp) {
+static algokit_heap *algokit_heap_create_ordered(size_t capacity, algokit_key_cmp_fn cmp, int min) {
     algokit_heap *heap;
 
     if (!cmp) {
@@ -80,6 +81,7 @@ algokit_heap *algokit_heap_create(size_t capacity, algokit_key_cmp_fn cmp) {
     heap->size = 0;
     heap->capacity = capacity;
     heap->cmp = cmp;
+    heap->min = min;
     heap->items = NULL;
 
     if (capacity > 0) {
@@ -93,6 +95,14 @@ algokit_heap *algokit_heap_create(size_t capacity, algokit_key_cmp_fn cmp) {
     return heap;
 }
 
+algokit_heap *algokit_heap_create(size_t capacity, algokit_key_cmp_fn cmp) {
+    return algokit_heap_create_ordered(capacity, cmp, 0);
+}
+
+algokit_heap *algokit_heap_create_min(size_t capacity, algokit_key_cmp_fn cmp) {
+    return algokit_heap_create_ordered(capacity, cmp, 1);
+}
+
 void algokit_heap_destroy(algokit_heap *heap, algokit_item_destroy_fn destroy) {
     size_t i;
 
@@ -142,6 +152,17 @@ int algokit_heap_extract(algokit_heap *heap, Item *out) {
     return 0;
 }
 
+int algokit_heap_replace_top(algokit_heap *heap, Item item, Item *out) {
+    if (!heap || !out || heap->size == 0) {
+        return -1;
+    }
+
+    *out = heap->items[0];
+    heap->items[0] = item;
+    algokit_heap_sift_down(heap, 0);
+    return 0;
+}
+
 int algokit_heap_peek(const algokit_heap *heap, Item *out) {
     if (!heap || !out || heap->size == 0) {
         return -1;
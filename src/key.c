@@ -0,0 +1,155 @@
+#include "algokit/key.h"
+
+#include <string.h>
+
+/* Default secrets of wyhash; any odd 64-bit constants with mixed bits work. */
+#define ALGOKIT_KEY_S0 UINT64_C(0xA0761D6478BD642F)
+#define ALGOKIT_KEY_S1 UINT64_C(0xE7037ED1A0B428DB)
+#define ALGOKIT_KEY_S2 UINT64_C(0x8EBC6AF09C88C6E3)
+#define ALGOKIT_KEY_S3 UINT64_C(0x589965CC75374CC3)
+
+/* Full 64x64 -> 128-bit product: *a receives the low half, *b the high half. */
+static void algokit_key_mum(uint64_t *a, uint64_t *b) {
+#if defined(__SIZEOF_INT128__)
+    __extension__ unsigned __int128 r = (unsigned __int128)*a * *b;
+    *a = (uint64_t)r;
+    *b = (uint64_t)(r >> 64);
+#else
+    uint64_t ha = *a >> 32;
+    uint64_t hb = *b >> 32;
+    uint64_t la = (uint32_t)*a;
+    uint64_t lb = (uint32_t)*b;
+    uint64_t rh = ha * hb;
+    uint64_t rm0 = ha * lb;
+    uint64_t rm1 = hb * la;
+    uint64_t rl = la * lb;
+    uint64_t t = rl + (rm0 << 32);
+    uint64_t carry = t < rl;
+    uint64_t lo = t + (rm1 << 32);
+
+    carry += lo < t;
+    *a = lo;
+    *b = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+#endif
+}
+
+static uint64_t algokit_key_fold(uint64_t a, uint64_t b) {
+    algokit_key_mum(&a, &b);
+    return a ^ b;
+}
+
+static uint64_t algokit_key_read64(const unsigned char *p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static uint64_t algokit_key_read32(const unsigned char *p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+/* Reads 1..3 bytes as one value: first, middle and last byte. */
+static uint64_t algokit_key_read_small(const unsigned char *p, size_t len) {
+    return ((uint64_t)p[0] << 16) | ((uint64_t)p[len >> 1] << 8) | p[len - 1];
+}
+
+/* splitmix64 finalizer. */
+uint64_t algokit_key_mix64(uint64_t x) {
+    x ^= x >> 30;
+    x *= UINT64_C(0xBF58476D1CE4E5B9);
+    x ^= x >> 27;
+    x *= UINT64_C(0x94D049BB133111EB);
+    x ^= x >> 31;
+    return x;
+}
+
+uint64_t algokit_key_hash_bytes(const void *data, size_t len, uint64_t seed) {
+    const unsigned char *p = (const unsigned char *)data;
+    uint64_t a;
+    uint64_t b;
+
+    seed ^= algokit_key_fold(seed ^ ALGOKIT_KEY_S0, ALGOKIT_KEY_S1);
+    if (len <= 16) {
+        if (len >= 4) {
+            /* Two overlapping 4-byte reads from each end cover 4..16 bytes. */
+            size_t step = (len >> 3) << 2;
+            a = (algokit_key_read32(p) << 32) | algokit_key_read32(p + step);
+            b = (algokit_key_read32(p + len - 4) << 32) | algokit_key_read32(p + len - 4 - step);
+        } else if (len > 0) {
+            a = algokit_key_read_small(p, len);
+            b = 0;
+        } else {
+            a = 0;
+            b = 0;
+        }
+    } else {
+        size_t i = len;
+
+        if (i > 48) {
+            /* Three independent lanes keep the multipliers busy on long inputs. */
+            uint64_t lane1 = seed;
+            uint64_t lane2 = seed;
+            do {
+                seed = algokit_key_fold(algokit_key_read64(p) ^ ALGOKIT_KEY_S1, algokit_key_read64(p + 8) ^ seed);
+                lane1 = algokit_key_fold(algokit_key_read64(p + 16) ^ ALGOKIT_KEY_S2, algokit_key_read64(p + 24) ^ lane1);
+                lane2 = algokit_key_fold(algokit_key_read64(p + 32) ^ ALGOKIT_KEY_S3, algokit_key_read64(p + 40) ^ lane2);
+                p += 48;
+                i -= 48;
+            } while (i > 48);
+            seed ^= lane1 ^ lane2;
+        }
+        while (i > 16) {
+            seed = algokit_key_fold(algokit_key_read64(p) ^ ALGOKIT_KEY_S1, algokit_key_read64(p + 8) ^ seed);
+            p += 16;
+            i -= 16;
+        }
+        a = algokit_key_read64(p + i - 16);
+        b = algokit_key_read64(p + i - 8);
+    }
+
+    a ^= ALGOKIT_KEY_S1;
+    b ^= seed;
+    algokit_key_mum(&a, &b);
+    return algokit_key_fold(a ^ ALGOKIT_KEY_S0 ^ (uint64_t)len, b ^ ALGOKIT_KEY_S1);
+}
+
+size_t algokit_key_hash_u32(const void *key) {
+    return (size_t)algokit_key_mix64(*(const uint32_t *)key);
+}
+
+size_t algokit_key_hash_u64(const void *key) {
+    return (size_t)algokit_key_mix64(*(const uint64_t *)key);
+}
+
+size_t algokit_key_hash_ptr(const void *key) {
+    return (size_t)algokit_key_mix64((uint64_t)(uintptr_t)key);
+}
+
+size_t algokit_key_hash_str(const void *key) {
+    const char *s = (const char *)key;
+    return (size_t)algokit_key_hash_bytes(s, strlen(s), 0);
+}
+
+int algokit_key_cmp_u32(const void *a, const void *b) {
+    uint32_t va = *(const uint32_t *)a;
+    uint32_t vb = *(const uint32_t *)b;
+    return (va > vb) - (va < vb);
+}
+
+int algokit_key_cmp_u64(const void *a, const void *b) {
+    uint64_t va = *(const uint64_t *)a;
+    uint64_t vb = *(const uint64_t *)b;
+    return (va > vb) - (va < vb);
+}
+
+int algokit_key_cmp_ptr(const void *a, const void *b) {
+    uintptr_t va = (uintptr_t)a;
+    uintptr_t vb = (uintptr_t)b;
+    return (va > vb) - (va < vb);
+}
+
+int algokit_key_cmp_str(const void *a, const void *b) {
+    return strcmp((const char *)a, (const char *)b);
+}
@@ -0,0 +1,118 @@
+#include "pool.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/* Slab header padded so the nodes that follow it are suitably aligned. */
+struct algokit_pool_slab {
+    union {
+        struct algokit_pool_slab *next;
+        long double align_ld;
+        long long align_ll;
+        void *align_ptr;
+    } header;
+};
+
+void algokit_pool_init(struct algokit_pool *pool, size_t node_size, size_t nodes_per_slab) {
+    algokit_pool_init_with(pool, node_size, nodes_per_slab, 0, malloc);
+}
+
+void algokit_pool_init_aligned(struct algokit_pool *pool, size_t node_size, size_t nodes_per_slab, size_t align) {
+    algokit_pool_init_with(pool, node_size, nodes_per_slab, align, malloc);
+}
+
+void algokit_pool_init_with(struct algokit_pool *pool, size_t node_size, size_t nodes_per_slab, size_t align,
+                            algokit_pool_alloc_fn slab_alloc) {
+    if (node_size < sizeof(void *)) {
+        node_size = sizeof(void *);
+    }
+    if (align == 0) {
+        align = sizeof(long long) > sizeof(void *) ? sizeof(long long) : sizeof(void *);
+    }
+    if (align < sizeof(void *)) {
+        align = sizeof(void *);
+    }
+
+    pool->slabs = NULL;
+    pool->spare = NULL;
+    pool->free_list = NULL;
+    pool->cursor = NULL;
+    pool->remaining = 0;
+    pool->node_size = (node_size + align - 1) / align * align;
+    pool->nodes_per_slab = nodes_per_slab ? nodes_per_slab : 64;
+    pool->align = align;
+    pool->slab_alloc = slab_alloc ? slab_alloc : malloc;
+}
+
+void *algokit_pool_alloc(struct algokit_pool *pool) {
+    void *node;
+
+    if (pool->free_list) {
+        node = pool->free_list;
+        pool->free_list = *(void **)node;
+        return node;
+    }
+
+    if (pool->remaining == 0) {
+        /* align - 1 extra bytes let the first node move up to an aligned address. */
+        size_t bytes = sizeof(struct algokit_pool_slab) + pool->align - 1 + pool->node_size * pool->nodes_per_slab;
+        struct algokit_pool_slab *slab = pool->spare;
+        if (slab) {
+            pool->spare = slab->header.next;
+        } else {
+            slab = (struct algokit_pool_slab *)pool->slab_alloc(bytes);
+        }
+        if (!slab) {
+            return NULL;
+        }
+        slab->header.next = pool->slabs;
+        pool->slabs = slab;
+        pool->cursor = (char *)(((uintptr_t)(slab + 1) + pool->align - 1) & ~(uintptr_t)(pool->align - 1));
+        pool->remaining = pool->nodes_per_slab;
+    }
+
+    node = pool->cursor;
+    pool->cursor += pool->node_size;
+    pool->remaining--;
+    return node;
+}
+
+void algokit_pool_free(struct algokit_pool *pool, void *node) {
+    if (!node) {
+        return;
+    }
+
+    *(void **)node = pool->free_list;
+    pool->free_list = node;
+}
+
+void algokit_pool_reset(struct algokit_pool *pool) {
+    while (pool->slabs) {
+        struct algokit_pool_slab *slab = pool->slabs;
+        pool->slabs = slab->header.next;
+        slab->header.next = pool->spare;
+        pool->spare = slab;
+    }
+
+    pool->free_list = NULL;
+    pool->cursor = NULL;
+    pool->remaining = 0;
+}
+
+void algokit_pool_release(struct algokit_pool *pool) {
+    struct algokit_pool_slab *slab;
+
+    algokit_pool_reset(pool);
+    slab = pool->spare;
+    while (slab) {
+        struct algokit_pool_slab *next = slab->header.next;
+        free(slab);
+        slab = next;
+    }
+
+    pool->spare = NULL;
+    pool->slabs = NULL;
+    pool->free_list = NULL;
+    pool->cursor = NULL;
+    pool->remaining = 0;
+}
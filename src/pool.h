@@ -0,0 +1,51 @@
+#ifndef ALGOKIT_POOL_H
+#define ALGOKIT_POOL_H
+
+#include <stddef.h>
+
+/*
+ * Internal fixed-size node pool (not part of the public API).
+ * Nodes are carved sequentially from malloc'ed slabs, so nodes allocated
+ * close together in time are close together in memory. Freed nodes go to a
+ * free list and are reused before the current slab is consumed further.
+ * reset forgets every node but keeps the slabs as spares, which alloc
+ * carves again before it mallocs a new one.
+ * Complexity: alloc/free O(1), reset/release O(number of slabs).
+ */
+
+struct algokit_pool_slab;
+
+/* Slab allocator; its blocks are released with free(), so it must be malloc-compatible. */
+typedef void *(*algokit_pool_alloc_fn)(size_t bytes);
+
+struct algokit_pool {
+    struct algokit_pool_slab *slabs;
+    struct algokit_pool_slab *spare;
+    void *free_list;
+    char *cursor;
+    size_t remaining;
+    size_t node_size;
+    size_t nodes_per_slab;
+    size_t align;
+    algokit_pool_alloc_fn slab_alloc;
+};
+
+void algokit_pool_init(struct algokit_pool *pool, size_t node_size, size_t nodes_per_slab);
+
+/* Like init, but every node starts at a multiple of align (a power of two, e.g. a cache line). */
+void algokit_pool_init_aligned(struct algokit_pool *pool, size_t node_size, size_t nodes_per_slab, size_t align);
+
+/* Like init_aligned (align 0 picks init's default), but slabs come from slab_alloc instead of malloc. */
+void algokit_pool_init_with(struct algokit_pool *pool, size_t node_size, size_t nodes_per_slab, size_t align,
+                            algokit_pool_alloc_fn slab_alloc);
+
+void *algokit_pool_alloc(struct algokit_pool *pool);
+
+void algokit_pool_free(struct algokit_pool *pool, void *node);
+
+/* Drops every node at once; the caller must hold no node from this pool. */
+void algokit_pool_reset(struct algokit_pool *pool);
+
+void algokit_pool_release(struct algokit_pool *pool);
+
+#endif /* ALGOKIT_POOL_H */
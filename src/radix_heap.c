@@ -0,0 +1,240 @@
+#include "algokit/radix_heap.h"
+
+#include <stdlib.h>
+
+#define ALGOKIT_RADIX_HEAP_BUCKETS 65
+
+struct algokit_radix_heap_entry {
+    uint64_t priority;
+    Item item;
+};
+
+struct algokit_radix_heap_bucket {
+    struct algokit_radix_heap_entry *entries;
+    size_t size;
+    size_t capacity;
+};
+
+struct algokit_radix_heap {
+    struct algokit_radix_heap_bucket buckets[ALGOKIT_RADIX_HEAP_BUCKETS];
+    size_t size;
+    uint64_t last;
+};
+
+static unsigned algokit_radix_heap_bit_length(uint64_t x) {
+#if defined(__GNUC__)
+    return x ? 64u - (unsigned)__builtin_clzll(x) : 0u;
+#else
+    unsigned n = 0;
+    while (x) {
+        x >>= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+static unsigned algokit_radix_heap_bucket_index(const algokit_radix_heap *heap, uint64_t priority) {
+    return algokit_radix_heap_bit_length(priority ^ heap->last);
+}
+
+static int algokit_radix_heap_bucket_reserve(struct algokit_radix_heap_bucket *bucket, size_t needed) {
+    size_t new_capacity;
+    struct algokit_radix_heap_entry *new_entries;
+
+    if (needed <= bucket->capacity) {
+        return 0;
+    }
+
+    new_capacity = bucket->capacity ? bucket->capacity : 8;
+    while (new_capacity < needed) {
+        new_capacity *= 2;
+    }
+
+    new_entries = (struct algokit_radix_heap_entry *)realloc(bucket->entries, new_capacity * sizeof(*new_entries));
+    if (!new_entries) {
+        return -1;
+    }
+
+    bucket->entries = new_entries;
+    bucket->capacity = new_capacity;
+    return 0;
+}
+
+static size_t algokit_radix_heap_first_bucket(const algokit_radix_heap *heap) {
+    size_t i;
+
+    for (i = 0; i < ALGOKIT_RADIX_HEAP_BUCKETS; i++) {
+        if (heap->buckets[i].size > 0) {
+            return i;
+        }
+    }
+
+    return ALGOKIT_RADIX_HEAP_BUCKETS;
+}
+
+static size_t algokit_radix_heap_min_entry(const struct algokit_radix_heap_bucket *bucket) {
+    size_t i;
+    size_t min = 0;
+
+    for (i = 1; i < bucket->size; i++) {
+        if (bucket->entries[i].priority < bucket->entries[min].priority) {
+            min = i;
+        }
+    }
+
+    return min;
+}
+
+/*
+ * Empty the smallest non-empty bucket: its minimum becomes the new `last`, and
+ * every entry in it then differs from `last` in a strictly lower bit, so it
+ * moves to a lower bucket. Target buckets are reserved first so a failed
+ * allocation leaves the heap unchanged.
+ */
+static int algokit_radix_heap_pull(algokit_radix_heap *heap) {
+    size_t counts[ALGOKIT_RADIX_HEAP_BUCKETS] = {0};
+    size_t index = algokit_radix_heap_first_bucket(heap);
+    struct algokit_radix_heap_bucket *bucket;
+    uint64_t last;
+    size_t i;
+
+    if (index == 0) {
+        return 0;
+    }
+
+    bucket = &heap->buckets[index];
+    last = bucket->entries[algokit_radix_heap_min_entry(bucket)].priority;
+
+    for (i = 0; i < bucket->size; i++) {
+        counts[algokit_radix_heap_bit_length(bucket->entries[i].priority ^ last)]++;
+    }
+    for (i = 0; i < index; i++) {
+        if (algokit_radix_heap_bucket_reserve(&heap->buckets[i], heap->buckets[i].size + counts[i]) != 0) {
+            return -1;
+        }
+    }
+
+    heap->last = last;
+    for (i = 0; i < bucket->size; i++) {
+        struct algokit_radix_heap_bucket *target = &heap->buckets[algokit_radix_heap_bucket_index(heap, bucket->entries[i].priority)];
+        target->entries[target->size++] = bucket->entries[i];
+    }
+    bucket->size = 0;
+    return 0;
+}
+
+algokit_radix_heap *algokit_radix_heap_create(void) {
+    algokit_radix_heap *heap = (algokit_radix_heap *)malloc(sizeof(*heap));
+    size_t i;
+
+    if (!heap) {
+        return NULL;
+    }
+
+    for (i = 0; i < ALGOKIT_RADIX_HEAP_BUCKETS; i++) {
+        heap->buckets[i].entries = NULL;
+        heap->buckets[i].size = 0;
+        heap->buckets[i].capacity = 0;
+    }
+    heap->size = 0;
+    heap->last = 0;
+    return heap;
+}
+
+void algokit_radix_heap_destroy(algokit_radix_heap *heap, algokit_item_destroy_fn destroy) {
+    size_t i;
+    size_t j;
+
+    if (!heap) {
+        return;
+    }
+
+    for (i = 0; i < ALGOKIT_RADIX_HEAP_BUCKETS; i++) {
+        if (destroy) {
+            for (j = 0; j < heap->buckets[i].size; j++) {
+                destroy(heap->buckets[i].entries[j].item.key, heap->buckets[i].entries[j].item.val);
+            }
+        }
+        free(heap->buckets[i].entries);
+    }
+
+    free(heap);
+}
+
+int algokit_radix_heap_insert(algokit_radix_heap *heap, uint64_t priority, Item item) {
+    struct algokit_radix_heap_bucket *bucket;
+
+    if (!heap || priority < heap->last) {
+        return -1;
+    }
+
+    bucket = &heap->buckets[algokit_radix_heap_bucket_index(heap, priority)];
+    if (algokit_radix_heap_bucket_reserve(bucket, bucket->size + 1) != 0) {
+        return -1;
+    }
+
+    bucket->entries[bucket->size].priority = priority;
+    bucket->entries[bucket->size].item = item;
+    bucket->size++;
+    heap->size++;
+    return 0;
+}
+
+int algokit_radix_heap_extract_min(algokit_radix_heap *heap, uint64_t *priority, Item *out) {
+    struct algokit_radix_heap_bucket *bucket;
+
+    if (!heap || !out || heap->size == 0) {
+        return -1;
+    }
+
+    if (heap->buckets[0].size == 0 && algokit_radix_heap_pull(heap) != 0) {
+        return -1;
+    }
+
+    bucket = &heap->buckets[0];
+    bucket->size--;
+    *out = bucket->entries[bucket->size].item;
+    if (priority) {
+        *priority = bucket->entries[bucket->size].priority;
+    }
+    heap->size--;
+    return 0;
+}
+
+int algokit_radix_heap_peek_min(const algokit_radix_heap *heap, uint64_t *priority, Item *out) {
+    const struct algokit_radix_heap_bucket *bucket;
+    size_t min;
+
+    if (!heap || !out || heap->size == 0) {
+        return -1;
+    }
+
+    bucket = &heap->buckets[algokit_radix_heap_first_bucket(heap)];
+    min = bucket == &heap->buckets[0] ? bucket->size - 1 : algokit_radix_heap_min_entry(bucket);
+    *out = bucket->entries[min].item;
+    if (priority) {
+        *priority = bucket->entries[min].priority;
+    }
+    return 0;
+}
+
+uint64_t algokit_radix_heap_last(const algokit_radix_heap *heap) {
+    if (!heap) {
+        return 0;
+    }
+
+    return heap->last;
+}
+
+size_t algokit_radix_heap_size(const algokit_radix_heap *heap) {
+    if (!heap) {
+        return 0;
+    }
+
+    return heap->size;
+}
+
+int algokit_radix_heap_is_empty(const algokit_radix_heap *heap) {
+    return !heap || heap->size == 0;
+}
@@ -2,15 +2,22 @@
 
 #include <stdlib.h>
 
+#include "pool.h"
+
+/* Nodes carved per slab: 256 nodes of 48 bytes make a 12 KiB slab on 64-bit targets. */
+#define ALGOKIT_RBTREE_NODES_PER_SLAB 256
+
 struct algokit_rbtree_node {
     Item item;
     struct algokit_rbtree_node *left;
     struct algokit_rbtree_node *right;
+    size_t size;
     int red;
 };
 
 struct algokit_rbtree {
     struct algokit_rbtree_node *root;
+    struct algokit_pool pool;
     algokit_key_cmp_fn cmp;
 };
 
@@ -22,28 +29,36 @@ static int algokit_rbtree_is_red(const struct algokit_rbtree_node *node) {
     return node && node->red;
 }
 
-static struct algokit_rbtree_node *algokit_rbtree_node_create(Item item) {
-    struct algokit_rbtree_node *node = (struct algokit_rbtree_node *)malloc(sizeof(*node));
+static size_t algokit_rbtree_node_size(const struct algokit_rbtree_node *node) {
+    return node ? node->size : 0;
+}
+
+/* Recomputes h's subtree size from its children, which must already be correct. */
+static void algokit_rbtree_update_size(struct algokit_rbtree_node *h) {
+    h->size = 1 + algokit_rbtree_node_size(h->left) + algokit_rbtree_node_size(h->right);
+}
+
+static struct algokit_rbtree_node *algokit_rbtree_node_create(algokit_rbtree *tree, Item item) {
+    struct algokit_rbtree_node *node = (struct algokit_rbtree_node *)algokit_pool_alloc(&tree->pool);
     if (!node) {
         return NULL;
     }
     node->item = item;
     node->left = NULL;
     node->right = NULL;
+    node->size = 1;
     node->red = 1;
     return node;
 }
 
-static void algokit_rbtree_node_destroy(struct algokit_rbtree_node *node, algokit_item_destroy_fn destroy) {
+/* Only walked for a destroy callback: the nodes themselves go back with their slabs. */
+static void algokit_rbtree_node_destroy(const struct algokit_rbtree_node *node, algokit_item_destroy_fn destroy) {
     if (!node) {
         return;
     }
     algokit_rbtree_node_destroy(node->left, destroy);
     algokit_rbtree_node_destroy(node->right, destroy);
-    if (destroy) {
-        destroy(node->item.key, node->item.val);
-    }
-    free(node);
+    destroy(node->item.key, node->item.val);
 }
 
 static struct algokit_rbtree_node *algokit_rbtree_rotate_left(struct algokit_rbtree_node *h) {
@@ -52,6 +67,8 @@ static struct algokit_rbtree_node *algokit_rbtree_rotate_left(struct algokit_rbt
     x->left = h;
     x->red = h->red;
     h->red = 1;
+    algokit_rbtree_update_size(h);
+    algokit_rbtree_update_size(x);
     return x;
 }
 
@@ -61,9 +78,12 @@ static struct algokit_rbtree_node *algokit_rbtree_rotate_right(struct algokit_rb
     x->right = h;
     x->red = h->red;
     h->red = 1;
+    algokit_rbtree_update_size(h);
+    algokit_rbtree_update_size(x);
     return x;
 }
 
+/* Only colors change, so subtree sizes need no update here. */
 static void algokit_rbtree_flip_colors(struct algokit_rbtree_node *h) {
     h->red = !h->red;
     if (h->left) {
@@ -84,6 +104,8 @@ static struct algokit_rbtree_node *algokit_rbtree_fix_up(struct algokit_rbtree_n
     if (algokit_rbtree_is_red(h->left) && algokit_rbtree_is_red(h->right)) {
         algokit_rbtree_flip_colors(h);
     }
+    /* Every insert and remove path returns through here, after its children were updated. */
+    algokit_rbtree_update_size(h);
     return h;
 }
 
@@ -113,9 +135,9 @@ static struct algokit_rbtree_node *algokit_rbtree_min_node(struct algokit_rbtree
     return h;
 }
 
-static struct algokit_rbtree_node *algokit_rbtree_delete_min(struct algokit_rbtree_node *h) {
+static struct algokit_rbtree_node *algokit_rbtree_delete_min(algokit_rbtree *tree, struct algokit_rbtree_node *h) {
     if (!h->left) {
-        free(h);
+        algokit_pool_free(&tree->pool, h);
         return NULL;
     }
 
@@ -123,7 +145,7 @@ static struct algokit_rbtree_node *algokit_rbtree_delete_min(struct algokit_rbtr
         h = algokit_rbtree_move_red_left(h);
     }
 
-    h->left = algokit_rbtree_delete_min(h->left);
+    h->left = algokit_rbtree_delete_min(tree, h->left);
     return algokit_rbtree_fix_up(h);
 }
 
@@ -132,7 +154,7 @@ static struct algokit_rbtree_node *algokit_rbtree_insert_node(algokit_rbtree *tr
 
     if (!h) {
         *inserted = 1;
-        return algokit_rbtree_node_create(item);
+        return algokit_rbtree_node_create(tree, item);
     }
 
     cmp = algokit_rbtree_cmp(tree, item.key, h->item.key);
@@ -182,7 +204,7 @@ static struct algokit_rbtree_node *algokit_rbtree_remove_node(algokit_rbtree *tr
         if (algokit_rbtree_cmp(tree, key, h->item.key) == 0 && !h->right) {
             *out = h->item;
             *removed = 1;
-            free(h);
+            algokit_pool_free(&tree->pool, h);
             return NULL;
         }
         if (h->right && !algokit_rbtree_is_red(h->right) && !algokit_rbtree_is_red(h->right->left)) {
@@ -193,7 +215,7 @@ static struct algokit_rbtree_node *algokit_rbtree_remove_node(algokit_rbtree *tr
             *out = h->item;
             *removed = 1;
             h->item = min->item;
-            h->right = algokit_rbtree_delete_min(h->right);
+            h->right = algokit_rbtree_delete_min(tree, h->right);
         } else {
             h->right = algokit_rbtree_remove_node(tree, h->right, key, out, removed);
         }
@@ -202,6 +224,26 @@ static struct algokit_rbtree_node *algokit_rbtree_remove_node(algokit_rbtree *tr
     return algokit_rbtree_fix_up(h);
 }
 
+/* Number of keys < key, or <= key when inclusive is set. */
+static size_t algokit_rbtree_rank_node(const algokit_rbtree *tree, const struct algokit_rbtree_node *node,
+                                       const void *key, int inclusive) {
+    size_t rank = 0;
+
+    while (node) {
+        int cmp = algokit_rbtree_cmp(tree, key, node->item.key);
+        if (cmp < 0 || (cmp == 0 && !inclusive)) {
+            node = node->left;
+        } else {
+            rank += algokit_rbtree_node_size(node->left) + 1;
+            if (cmp == 0) {
+                break;
+            }
+            node = node->right;
+        }
+    }
+    return rank;
+}
+
 static int algokit_rbtree_traverse_node(const struct algokit_rbtree_node *node, algokit_rbtree_visit_fn visit, void *ctx, int order) {
     if (!node) {
         return 0;
@@ -239,6 +281,7 @@ algokit_rbtree *algokit_rbtree_create(algokit_key_cmp_fn cmp) {
     }
 
     tree->root = NULL;
+    algokit_pool_init(&tree->pool, sizeof(struct algokit_rbtree_node), ALGOKIT_RBTREE_NODES_PER_SLAB);
     tree->cmp = cmp;
     return tree;
 }
@@ -248,7 +291,10 @@ void algokit_rbtree_destroy(algokit_rbtree *tree, algokit_item_destroy_fn destro
         return;
     }
 
-    algokit_rbtree_node_destroy(tree->root, destroy);
+    if (destroy) {
+        algokit_rbtree_node_destroy(tree->root, destroy);
+    }
+    algokit_pool_release(&tree->pool);
     free(tree);
 }
 
@@ -318,3 +364,57 @@ int algokit_rbtree_traverse_postorder(const algokit_rbtree *tree, algokit_rbtree
 
     return algokit_rbtree_traverse_node(tree->root, visit, ctx, 2);
 }
+
+size_t algokit_rbtree_size(const algokit_rbtree *tree) {
+    if (!tree) {
+        return 0;
+    }
+
+    return algokit_rbtree_node_size(tree->root);
+}
+
+int algokit_rbtree_select(const algokit_rbtree *tree, size_t k, Item *out) {
+    const struct algokit_rbtree_node *node;
+
+    if (!tree || !out) {
+        return -1;
+    }
+
+    node = tree->root;
+    while (node) {
+        size_t left = algokit_rbtree_node_size(node->left);
+        if (k < left) {
+            node = node->left;
+        } else if (k > left) {
+            k -= left + 1;
+            node = node->right;
+        } else {
+            *out = node->item;
+            return 0;
+        }
+    }
+    return 1;
+}
+
+int algokit_rbtree_rank(const algokit_rbtree *tree, const void *key, size_t *out) {
+    if (!tree || !key || !out) {
+        return -1;
+    }
+
+    *out = algokit_rbtree_rank_node(tree, tree->root, key, 0);
+    return 0;
+}
+
+int algokit_rbtree_count_range(const algokit_rbtree *tree, const void *lo, const void *hi, size_t *out) {
+    size_t below_lo;
+    size_t up_to_hi;
+
+    if (!tree || !lo || !hi || !out) {
+        return -1;
+    }
+
+    below_lo = algokit_rbtree_rank_node(tree, tree->root, lo, 0);
+    up_to_hi = algokit_rbtree_rank_node(tree, tree->root, hi, 1);
+    *out = up_to_hi > below_lo ? up_to_hi - below_lo : 0;
+    return 0;
+}
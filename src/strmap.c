@@ -0,0 +1,315 @@
+#include "algokit/strmap.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "algokit/key.h"
+
+#define ALGOKIT_STRMAP_EMPTY SIZE_MAX
+#define ALGOKIT_STRMAP_MIN_ARENA 256
+
+struct algokit_strmap_slot {
+    size_t hash;
+    size_t offset;
+    uint32_t len;
+    uint32_t prefix;
+    void *val;
+};
+
+struct algokit_strmap {
+    struct algokit_strmap_slot *slots;
+    size_t capacity;
+    size_t size;
+    unsigned shift;
+    char *arena;
+    size_t arena_used;
+    size_t arena_capacity;
+    size_t arena_dead;
+};
+
+static unsigned algokit_strmap_bits(size_t capacity) {
+    unsigned bits = 3;
+
+    while (((size_t)1 << bits) < capacity) {
+        bits++;
+    }
+    return bits;
+}
+
+static size_t algokit_strmap_index(const algokit_strmap *map, size_t hash) {
+    return (size_t)(((uint64_t)hash * UINT64_C(0x9E3779B97F4A7C15)) >> map->shift);
+}
+
+/* First 4 key bytes, zero-padded; together with len this tells short keys apart exactly. */
+static uint32_t algokit_strmap_prefix(const char *key, size_t len) {
+    uint32_t prefix = 0;
+
+    if (len > 0) {
+        memcpy(&prefix, key, len < sizeof(prefix) ? len : sizeof(prefix));
+    }
+    return prefix;
+}
+
+static int algokit_strmap_alloc(algokit_strmap *map, size_t capacity) {
+    unsigned bits = algokit_strmap_bits(capacity);
+    size_t count = (size_t)1 << bits;
+    struct algokit_strmap_slot *slots = (struct algokit_strmap_slot *)malloc(count * sizeof(*slots));
+    size_t i;
+
+    if (!slots) {
+        return -1;
+    }
+
+    for (i = 0; i < count; i++) {
+        slots[i].offset = ALGOKIT_STRMAP_EMPTY;
+    }
+    map->slots = slots;
+    map->capacity = count;
+    map->shift = 64u - bits;
+    return 0;
+}
+
+/* Returns the slot holding the key, or the empty slot where it would go. */
+static size_t algokit_strmap_find(const algokit_strmap *map, const char *key, size_t len, size_t hash) {
+    size_t mask = map->capacity - 1;
+    size_t idx = algokit_strmap_index(map, hash);
+    uint32_t prefix = algokit_strmap_prefix(key, len);
+
+    for (;; idx = (idx + 1) & mask) {
+        const struct algokit_strmap_slot *slot = &map->slots[idx];
+
+        if (slot->offset == ALGOKIT_STRMAP_EMPTY) {
+            return idx;
+        }
+        if (slot->hash == hash && slot->len == len && slot->prefix == prefix &&
+            (len <= sizeof(prefix) || memcmp(map->arena + slot->offset, key, len) == 0)) {
+            return idx;
+        }
+    }
+}
+
+static int algokit_strmap_resize(algokit_strmap *map, size_t new_capacity) {
+    struct algokit_strmap_slot *old_slots = map->slots;
+    size_t old_capacity = map->capacity;
+    unsigned old_shift = map->shift;
+    size_t mask;
+    size_t i;
+
+    if (algokit_strmap_alloc(map, new_capacity) != 0) {
+        map->slots = old_slots;
+        map->capacity = old_capacity;
+        map->shift = old_shift;
+        return -1;
+    }
+
+    /* Keys are unique, so each one only needs the first empty slot from its home. */
+    mask = map->capacity - 1;
+    for (i = 0; i < old_capacity; i++) {
+        if (old_slots[i].offset != ALGOKIT_STRMAP_EMPTY) {
+            size_t idx = algokit_strmap_index(map, old_slots[i].hash);
+            while (map->slots[idx].offset != ALGOKIT_STRMAP_EMPTY) {
+                idx = (idx + 1) & mask;
+            }
+            map->slots[idx] = old_slots[i];
+        }
+    }
+
+    free(old_slots);
+    return 0;
+}
+
+/*
+ * Makes room for extra more key bytes. When at least half of the arena
+ * belongs to deleted keys, the live keys are copied into a fresh arena
+ * (and their slot offsets rewritten) instead of growing the old one.
+ */
+static int algokit_strmap_reserve_arena(algokit_strmap *map, size_t extra) {
+    size_t live = map->arena_used - map->arena_dead;
+    size_t capacity;
+    char *arena;
+
+    if (extra <= map->arena_capacity - map->arena_used) {
+        return 0;
+    }
+
+    if (map->arena_dead * 2 >= map->arena_used) {
+        size_t used = 0;
+        size_t i;
+
+        capacity = ALGOKIT_STRMAP_MIN_ARENA;
+        while (capacity < (live + extra) * 2) {
+            capacity *= 2;
+        }
+        arena = (char *)malloc(capacity);
+        if (!arena) {
+            return -1;
+        }
+        for (i = 0; i < map->capacity; i++) {
+            struct algokit_strmap_slot *slot = &map->slots[i];
+            if (slot->offset != ALGOKIT_STRMAP_EMPTY) {
+                memcpy(arena + used, map->arena + slot->offset, slot->len);
+                slot->offset = used;
+                used += slot->len;
+            }
+        }
+        free(map->arena);
+        map->arena = arena;
+        map->arena_used = used;
+        map->arena_capacity = capacity;
+        map->arena_dead = 0;
+        return 0;
+    }
+
+    capacity = map->arena_capacity ? map->arena_capacity : ALGOKIT_STRMAP_MIN_ARENA;
+    while (capacity - map->arena_used < extra) {
+        capacity *= 2;
+    }
+    arena = (char *)realloc(map->arena, capacity);
+    if (!arena) {
+        return -1;
+    }
+    map->arena = arena;
+    map->arena_capacity = capacity;
+    return 0;
+}
+
+algokit_strmap *algokit_strmap_create(size_t capacity) {
+    algokit_strmap *map;
+
+    if (capacity == 0) {
+        return NULL;
+    }
+
+    map = (algokit_strmap *)malloc(sizeof(*map));
+    if (!map) {
+        return NULL;
+    }
+
+    if (algokit_strmap_alloc(map, capacity) != 0) {
+        free(map);
+        return NULL;
+    }
+
+    map->size = 0;
+    map->arena = NULL;
+    map->arena_used = 0;
+    map->arena_capacity = 0;
+    map->arena_dead = 0;
+    return map;
+}
+
+void algokit_strmap_destroy(algokit_strmap *map) {
+    if (!map) {
+        return;
+    }
+
+    free(map->arena);
+    free(map->slots);
+    free(map);
+}
+
+int algokit_strmap_put(algokit_strmap *map, const char *key, size_t len, void *val) {
+    struct algokit_strmap_slot *slot;
+    size_t hash;
+    size_t idx;
+
+    if (!map || (!key && len > 0) || len > UINT32_MAX) {
+        return -1;
+    }
+
+    hash = (size_t)algokit_key_hash_bytes(key, len, 0);
+    idx = algokit_strmap_find(map, key, len, hash);
+    if (map->slots[idx].offset != ALGOKIT_STRMAP_EMPTY) {
+        return 1;
+    }
+
+    if ((map->size + 1) * 4 > map->capacity * 3) {
+        if (algokit_strmap_resize(map, map->capacity * 2) != 0) {
+            return -1;
+        }
+        idx = algokit_strmap_find(map, key, len, hash);
+    }
+
+    if (algokit_strmap_reserve_arena(map, len) != 0) {
+        return -1;
+    }
+    if (len > 0) {
+        memcpy(map->arena + map->arena_used, key, len);
+    }
+
+    slot = &map->slots[idx];
+    slot->hash = hash;
+    slot->offset = map->arena_used;
+    slot->len = (uint32_t)len;
+    slot->prefix = algokit_strmap_prefix(key, len);
+    slot->val = val;
+    map->arena_used += len;
+    map->size++;
+    return 0;
+}
+
+int algokit_strmap_get(const algokit_strmap *map, const char *key, size_t len, void **out) {
+    size_t idx;
+
+    if (!map || (!key && len > 0) || !out) {
+        return -1;
+    }
+
+    idx = algokit_strmap_find(map, key, len, (size_t)algokit_key_hash_bytes(key, len, 0));
+    if (map->slots[idx].offset == ALGOKIT_STRMAP_EMPTY) {
+        return 1;
+    }
+
+    *out = map->slots[idx].val;
+    return 0;
+}
+
+int algokit_strmap_delete(algokit_strmap *map, const char *key, size_t len, void **out) {
+    size_t mask;
+    size_t hole;
+    size_t idx;
+
+    if (!map || (!key && len > 0) || !out) {
+        return -1;
+    }
+
+    hole = algokit_strmap_find(map, key, len, (size_t)algokit_key_hash_bytes(key, len, 0));
+    if (map->slots[hole].offset == ALGOKIT_STRMAP_EMPTY) {
+        return 1;
+    }
+    *out = map->slots[hole].val;
+    map->arena_dead += map->slots[hole].len;
+
+    /* Backward shift, as in algokit_hash_u64: later entries of the run move into the hole. */
+    mask = map->capacity - 1;
+    idx = hole;
+    for (;;) {
+        size_t home;
+
+        idx = (idx + 1) & mask;
+        if (map->slots[idx].offset == ALGOKIT_STRMAP_EMPTY) {
+            break;
+        }
+        home = algokit_strmap_index(map, map->slots[idx].hash);
+        if (((idx - home) & mask) >= ((idx - hole) & mask)) {
+            map->slots[hole] = map->slots[idx];
+            hole = idx;
+        }
+    }
+    map->slots[hole].offset = ALGOKIT_STRMAP_EMPTY;
+    map->size--;
+
+    if (map->capacity > 8 && map->size * 8 < map->capacity) {
+        algokit_strmap_resize(map, map->capacity / 2);
+    }
+    return 0;
+}
+
+size_t algokit_strmap_size(const algokit_strmap *map) {
+    return map ? map->size : 0;
+}
+
+size_t algokit_strmap_arena_bytes(const algokit_strmap *map) {
+    return map ? map->arena_used : 0;
+}
@@ -0,0 +1,228 @@
+#include "algokit/timer_wheel.h"
+
+#include <stdlib.h>
+
+#include "pool.h"
+
+#define ALGOKIT_TIMER_WHEEL_BITS 6
+#define ALGOKIT_TIMER_WHEEL_SLOTS (1u << ALGOKIT_TIMER_WHEEL_BITS)
+#define ALGOKIT_TIMER_WHEEL_MASK (ALGOKIT_TIMER_WHEEL_SLOTS - 1u)
+#define ALGOKIT_TIMER_WHEEL_LEVELS 11
+
+/*
+ * Slots are intrusive singly linked lists with a back pointer to whatever
+ * points at the node (the slot head or the previous node's next field), so a
+ * timer can be unlinked in O(1) without knowing which slot holds it.
+ */
+struct algokit_timer_wheel_timer {
+    struct algokit_timer_wheel_timer *next;
+    struct algokit_timer_wheel_timer **pprev;
+    uint64_t expires;
+    Item item;
+};
+
+struct algokit_timer_wheel {
+    struct algokit_timer_wheel_timer *slots[ALGOKIT_TIMER_WHEEL_LEVELS][ALGOKIT_TIMER_WHEEL_SLOTS];
+    struct algokit_pool pool;
+    uint64_t now;
+    size_t size;
+};
+
+static unsigned algokit_timer_wheel_bit_length(uint64_t x) {
+#if defined(__GNUC__)
+    return x ? 64u - (unsigned)__builtin_clzll(x) : 0u;
+#else
+    unsigned n = 0;
+    while (x) {
+        x >>= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+static void algokit_timer_wheel_link(struct algokit_timer_wheel_timer **head, struct algokit_timer_wheel_timer *timer) {
+    timer->next = *head;
+    if (*head) {
+        (*head)->pprev = &timer->next;
+    }
+    *head = timer;
+    timer->pprev = head;
+}
+
+static void algokit_timer_wheel_unlink(struct algokit_timer_wheel_timer *timer) {
+    *timer->pprev = timer->next;
+    if (timer->next) {
+        timer->next->pprev = timer->pprev;
+    }
+    timer->next = NULL;
+    timer->pprev = NULL;
+}
+
+/* Place a timer relative to `ref`, the next tick the wheel will process. */
+static void algokit_timer_wheel_place(algokit_timer_wheel *wheel, struct algokit_timer_wheel_timer *timer, uint64_t ref) {
+    uint64_t diff = timer->expires > ref ? timer->expires - ref : 0;
+    unsigned bits = algokit_timer_wheel_bit_length(diff);
+    unsigned level = bits ? (bits - 1) / ALGOKIT_TIMER_WHEEL_BITS : 0;
+    unsigned slot = (unsigned)(timer->expires >> (level * ALGOKIT_TIMER_WHEEL_BITS)) & ALGOKIT_TIMER_WHEEL_MASK;
+
+    algokit_timer_wheel_link(&wheel->slots[level][slot], timer);
+}
+
+/* Re-place every timer of one higher-level slot; each lands in a lower level. */
+static void algokit_timer_wheel_cascade(algokit_timer_wheel *wheel, unsigned level, uint64_t tick) {
+    unsigned slot = (unsigned)(tick >> (level * ALGOKIT_TIMER_WHEEL_BITS)) & ALGOKIT_TIMER_WHEEL_MASK;
+    struct algokit_timer_wheel_timer *timer = wheel->slots[level][slot];
+
+    wheel->slots[level][slot] = NULL;
+    while (timer) {
+        struct algokit_timer_wheel_timer *next = timer->next;
+        algokit_timer_wheel_place(wheel, timer, tick);
+        timer = next;
+    }
+}
+
+algokit_timer_wheel *algokit_timer_wheel_create(uint64_t now) {
+    algokit_timer_wheel *wheel = (algokit_timer_wheel *)calloc(1, sizeof(*wheel));
+
+    if (!wheel) {
+        return NULL;
+    }
+
+    algokit_pool_init(&wheel->pool, sizeof(struct algokit_timer_wheel_timer), 256);
+    wheel->now = now;
+    wheel->size = 0;
+    return wheel;
+}
+
+void algokit_timer_wheel_destroy(algokit_timer_wheel *wheel, algokit_item_destroy_fn destroy) {
+    unsigned level;
+    unsigned slot;
+
+    if (!wheel) {
+        return;
+    }
+
+    if (destroy) {
+        for (level = 0; level < ALGOKIT_TIMER_WHEEL_LEVELS; level++) {
+            for (slot = 0; slot < ALGOKIT_TIMER_WHEEL_SLOTS; slot++) {
+                struct algokit_timer_wheel_timer *timer = wheel->slots[level][slot];
+                while (timer) {
+                    destroy(timer->item.key, timer->item.val);
+                    timer = timer->next;
+                }
+            }
+        }
+    }
+
+    algokit_pool_release(&wheel->pool);
+    free(wheel);
+}
+
+int algokit_timer_wheel_schedule(algokit_timer_wheel *wheel, uint64_t delay, Item item, algokit_timer_wheel_timer **handle) {
+    struct algokit_timer_wheel_timer *timer;
+
+    if (!wheel) {
+        return -1;
+    }
+
+    timer = (struct algokit_timer_wheel_timer *)algokit_pool_alloc(&wheel->pool);
+    if (!timer) {
+        return -1;
+    }
+
+    if (delay == 0) {
+        delay = 1;
+    }
+    timer->expires = delay > UINT64_MAX - wheel->now ? UINT64_MAX : wheel->now + delay;
+    timer->item = item;
+    algokit_timer_wheel_place(wheel, timer, wheel->now + 1);
+    wheel->size++;
+
+    if (handle) {
+        *handle = timer;
+    }
+    return 0;
+}
+
+int algokit_timer_wheel_cancel(algokit_timer_wheel *wheel, algokit_timer_wheel_timer *timer, Item *out) {
+    if (!wheel || !timer || !timer->pprev) {
+        return -1;
+    }
+
+    algokit_timer_wheel_unlink(timer);
+    if (out) {
+        *out = timer->item;
+    }
+    algokit_pool_free(&wheel->pool, timer);
+    wheel->size--;
+    return 0;
+}
+
+size_t algokit_timer_wheel_advance(algokit_timer_wheel *wheel, uint64_t ticks, algokit_timer_wheel_expire_fn expire, void *ctx) {
+    size_t expired = 0;
+
+    if (!wheel) {
+        return 0;
+    }
+
+    while (ticks > 0 && wheel->now < UINT64_MAX) {
+        uint64_t tick = wheel->now + 1;
+        unsigned level = 1;
+        struct algokit_timer_wheel_timer *due;
+
+        if (wheel->size == 0) {
+            wheel->now = ticks > UINT64_MAX - wheel->now ? UINT64_MAX : wheel->now + ticks;
+            break;
+        }
+
+        /* Cascade each level whose lower levels all wrapped around at this tick. */
+        while (level < ALGOKIT_TIMER_WHEEL_LEVELS && (tick & ((UINT64_C(1) << (level * ALGOKIT_TIMER_WHEEL_BITS)) - 1)) == 0) {
+            algokit_timer_wheel_cascade(wheel, level, tick);
+            level++;
+        }
+
+        /*
+         * Detach the due slot before firing so callbacks may schedule or
+         * cancel timers (including not-yet-fired ones from this slot).
+         */
+        wheel->now = tick;
+        due = wheel->slots[0][tick & ALGOKIT_TIMER_WHEEL_MASK];
+        wheel->slots[0][tick & ALGOKIT_TIMER_WHEEL_MASK] = NULL;
+        if (due) {
+            due->pprev = &due;
+        }
+        while (due) {
+            struct algokit_timer_wheel_timer *timer = due;
+            Item item = timer->item;
+
+            algokit_timer_wheel_unlink(timer);
+            algokit_pool_free(&wheel->pool, timer);
+            wheel->size--;
+            expired++;
+            if (expire) {
+                expire(&item, ctx);
+            }
+        }
+
+        ticks--;
+    }
+
+    return expired;
+}
+
+uint64_t algokit_timer_wheel_now(const algokit_timer_wheel *wheel) {
+    if (!wheel) {
+        return 0;
+    }
+
+    return wheel->now;
+}
+
+size_t algokit_timer_wheel_size(const algokit_timer_wheel *wheel) {
+    if (!wheel) {
+        return 0;
+    }
+
+    return wheel->size;
+}
@@ -0,0 +1,129 @@
+#include "algokit/topk.h"
+
+#include <stdlib.h>
+
+#include "algokit/heap.h"
+
+struct algokit_topk {
+    algokit_heap *heap;
+    size_t k;
+    algokit_key_cmp_fn cmp;
+};
+
+algokit_topk *algokit_topk_create(size_t k, algokit_key_cmp_fn cmp) {
+    algokit_topk *topk;
+
+    if (!cmp || k == 0) {
+        return NULL;
+    }
+
+    topk = (algokit_topk *)malloc(sizeof(*topk));
+    if (!topk) {
+        return NULL;
+    }
+
+    topk->heap = algokit_heap_create_min(k, cmp);
+    if (!topk->heap) {
+        free(topk);
+        return NULL;
+    }
+
+    topk->k = k;
+    topk->cmp = cmp;
+    return topk;
+}
+
+void algokit_topk_destroy(algokit_topk *topk, algokit_item_destroy_fn destroy) {
+    if (!topk) {
+        return;
+    }
+
+    algokit_heap_destroy(topk->heap, destroy);
+    free(topk);
+}
+
+int algokit_topk_offer(algokit_topk *topk, Item item, Item *out) {
+    Item weakest;
+
+    if (!topk || !out) {
+        return -1;
+    }
+
+    if (algokit_heap_size(topk->heap) < topk->k) {
+        return algokit_heap_insert(topk->heap, item) == 0 ? 0 : -1;
+    }
+
+    /* Fast reject: compare against the root before touching the heap. */
+    algokit_heap_peek(topk->heap, &weakest);
+    if (topk->cmp(item.key, weakest.key) <= 0) {
+        *out = item;
+        return 1;
+    }
+
+    algokit_heap_replace_top(topk->heap, item, out);
+    return 1;
+}
+
+int algokit_topk_threshold(const algokit_topk *topk, Item *out) {
+    if (!topk || !out) {
+        return -1;
+    }
+
+    return algokit_heap_peek(topk->heap, out);
+}
+
+int algokit_topk_drain_sorted(algokit_topk *topk, Item *out, size_t *count) {
+    size_t n;
+
+    if (!topk || !count || (!out && !algokit_heap_is_empty(topk->heap))) {
+        return -1;
+    }
+
+    /* The min-heap yields the weakest first, so fill the buffer from the end. */
+    n = algokit_heap_size(topk->heap);
+    *count = n;
+    while (n > 0) {
+        algokit_heap_extract(topk->heap, &out[--n]);
+    }
+
+    return 0;
+}
+
+int algokit_topk_merge(algokit_topk *dst, algokit_topk *src, algokit_item_destroy_fn destroy) {
+    Item item;
+    Item dropped;
+
+    if (!dst || !src || dst == src) {
+        return -1;
+    }
+
+    while (algokit_heap_peek(src->heap, &item) == 0) {
+        int rc = algokit_topk_offer(dst, item, &dropped);
+
+        if (rc < 0) {
+            return -1;
+        }
+        algokit_heap_extract(src->heap, &item);
+        if (rc == 1 && destroy) {
+            destroy(dropped.key, dropped.val);
+        }
+    }
+
+    return 0;
+}
+
+size_t algokit_topk_size(const algokit_topk *topk) {
+    if (!topk) {
+        return 0;
+    }
+
+    return algokit_heap_size(topk->heap);
+}
+
+size_t algokit_topk_capacity(const algokit_topk *topk) {
+    if (!topk) {
+        return 0;
+    }
+
+    return topk->k;
+}
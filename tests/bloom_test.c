@@ -0,0 +1,118 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "algokit/bloom.h"
+#include "algokit/hash.h"
+#include "algokit/key.h"
+
+#define KEY_COUNT 20000
+#define PROBE_COUNT 100000
+
+int main(void) {
+    static uint64_t keys[KEY_COUNT];
+    static Item items[KEY_COUNT];
+    algokit_bloom *bloom;
+    algokit_hash_lp *lp;
+    algokit_hash_sc *sc;
+    Item out;
+    size_t false_positives = 0;
+    size_t small_bytes;
+    uint64_t probe;
+    size_t i;
+
+    for (i = 0; i < KEY_COUNT; i++) {
+        keys[i] = (uint64_t)i * 2;
+        items[i].key = &keys[i];
+        items[i].val = &keys[i];
+    }
+
+    printf("bloom_test: create\n");
+    assert(algokit_bloom_create(100, 0.0) == NULL);
+    assert(algokit_bloom_create(100, 1.0) == NULL);
+    assert(algokit_bloom_build(NULL, 1, algokit_key_hash_u64, 0.01) == NULL);
+    assert(algokit_bloom_build(items, 1, NULL, 0.01) == NULL);
+    assert(algokit_bloom_add(NULL, 1) == -1);
+    assert(algokit_bloom_maybe_contains(NULL, 1) == 0);
+    bloom = algokit_bloom_create(0, 0.01);
+    assert(bloom != NULL);
+    assert(algokit_bloom_bytes(bloom) >= 32);
+    algokit_bloom_destroy(bloom);
+
+    printf("bloom_test: sizing follows the target rate\n");
+    bloom = algokit_bloom_create(KEY_COUNT, 0.05);
+    assert(bloom != NULL);
+    small_bytes = algokit_bloom_bytes(bloom);
+    algokit_bloom_destroy(bloom);
+    bloom = algokit_bloom_create(KEY_COUNT, 0.001);
+    assert(bloom != NULL);
+    assert(algokit_bloom_bytes(bloom) > small_bytes);
+    algokit_bloom_destroy(bloom);
+
+    printf("bloom_test: no false negatives\n");
+    bloom = algokit_bloom_build(items, KEY_COUNT, algokit_key_hash_u64, 0.01);
+    assert(bloom != NULL);
+    for (i = 0; i < KEY_COUNT; i++) {
+        assert(algokit_bloom_maybe_contains(bloom, algokit_key_hash_u64(&keys[i])) == 1);
+    }
+
+    printf("bloom_test: false positive rate\n");
+    /* Odd keys were never added; allow twice the target for sampling noise. */
+    for (i = 0; i < PROBE_COUNT; i++) {
+        probe = (uint64_t)i * 2 + 1;
+        false_positives += (size_t)algokit_bloom_maybe_contains(bloom, algokit_key_hash_u64(&probe));
+    }
+    assert(false_positives < PROBE_COUNT / 50);
+
+    printf("bloom_test: clear\n");
+    algokit_bloom_clear(bloom);
+    assert(algokit_bloom_maybe_contains(bloom, algokit_key_hash_u64(&keys[0])) == 0);
+    algokit_bloom_destroy(bloom);
+
+    printf("bloom_test: in front of linear probing\n");
+    bloom = algokit_bloom_create(KEY_COUNT, 0.01);
+    lp = algokit_hash_lp_create(16, algokit_key_hash_u64, algokit_key_cmp_u64);
+    assert(bloom != NULL && lp != NULL);
+    for (i = 0; i < KEY_COUNT; i++) {
+        assert(algokit_bloom_hash_lp_put(bloom, lp, algokit_key_hash_u64, items[i]) == 0);
+    }
+    assert(algokit_bloom_hash_lp_put(bloom, lp, algokit_key_hash_u64, items[0]) == 1);
+    for (i = 0; i < KEY_COUNT; i++) {
+        assert(algokit_bloom_hash_lp_get(bloom, lp, algokit_key_hash_u64, &keys[i], &out) == 0);
+        assert(out.val == &keys[i]);
+        probe = keys[i] + 1;
+        assert(algokit_bloom_hash_lp_get(bloom, lp, algokit_key_hash_u64, &probe, &out) == 1);
+    }
+    assert(algokit_bloom_hash_lp_get(bloom, lp, algokit_key_hash_u64, &keys[0], NULL) == -1);
+    assert(algokit_hash_lp_get_with_hash(lp, &keys[3], algokit_key_hash_u64(&keys[3]), &out) == 0);
+    algokit_hash_lp_destroy(lp, NULL);
+    algokit_bloom_destroy(bloom);
+
+    printf("bloom_test: in front of separate chaining\n");
+    sc = algokit_hash_sc_create(16, algokit_key_hash_u64, algokit_key_cmp_u64);
+    assert(sc != NULL);
+    for (i = 0; i < KEY_COUNT; i++) {
+        assert(algokit_hash_sc_put(sc, items[i]) == 0);
+    }
+    /* A filter built from the table's items guards keys inserted before it existed. */
+    bloom = algokit_bloom_build(items, KEY_COUNT, algokit_key_hash_u64, 0.01);
+    assert(bloom != NULL);
+    for (i = 0; i < KEY_COUNT; i++) {
+        assert(algokit_bloom_hash_sc_get(bloom, sc, algokit_key_hash_u64, &keys[i], &out) == 0);
+        assert(out.val == &keys[i]);
+        probe = keys[i] + 1;
+        assert(algokit_bloom_hash_sc_get(bloom, sc, algokit_key_hash_u64, &probe, &out) == 1);
+    }
+    probe = 1;
+    items[0].key = &probe;
+    assert(algokit_bloom_hash_sc_put(bloom, sc, algokit_key_hash_u64, items[0]) == 0);
+    assert(algokit_bloom_hash_sc_get(bloom, sc, algokit_key_hash_u64, &probe, &out) == 0);
+    assert(algokit_hash_sc_put_with_hash(sc, items[0], algokit_key_hash_u64(&probe)) == 1);
+    assert(algokit_hash_sc_delete_with_hash(sc, &probe, algokit_key_hash_u64(&probe), &out) == 0);
+    assert(algokit_hash_sc_delete_with_hash(sc, &probe, algokit_key_hash_u64(&probe), &out) == 1);
+    algokit_hash_sc_destroy(sc, NULL);
+    algokit_bloom_destroy(bloom);
+
+    printf("bloom_test: ok\n");
+    return 0;
+}
@@ -0,0 +1,168 @@
+#include <assert.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "algokit/bptree.h"
+
+#define KEY_COUNT 5000
+
+static int int_key_cmp(const void *a, const void *b) {
+    int va = *(const int *)a;
+    int vb = *(const int *)b;
+    return (va > vb) - (va < vb);
+}
+
+struct collect_ctx {
+    int *out;
+    size_t count;
+};
+
+static void collect_keys(const Item *item, void *ctx) {
+    struct collect_ctx *c = (struct collect_ctx *)ctx;
+    c->out[c->count++] = *(int *)item->key;
+}
+
+static size_t destroyed;
+
+static void free_key(void *key, void *val) {
+    (void)val;
+    free(key);
+    destroyed++;
+}
+
+static int *new_key(int value) {
+    int *key = (int *)malloc(sizeof(*key));
+    assert(key != NULL);
+    *key = value;
+    return key;
+}
+
+/* Checks that the tree holds exactly the keys marked in present, in order. */
+static void check_contents(const algokit_bptree *tree, const unsigned char *present, int *buffer) {
+    struct collect_ctx ctx;
+    size_t expected = 0;
+    int i;
+
+    ctx.out = buffer;
+    ctx.count = 0;
+    assert(algokit_bptree_traverse_inorder(tree, collect_keys, &ctx) == 0);
+    for (i = 0; i < KEY_COUNT; i++) {
+        if (present[i]) {
+            assert(expected < ctx.count && buffer[expected] == i);
+            expected++;
+        }
+    }
+    assert(ctx.count == expected && algokit_bptree_size(tree) == expected);
+}
+
+int main(void) {
+    algokit_bptree *tree;
+    static unsigned char present[KEY_COUNT];
+    static int buffer[KEY_COUNT];
+    struct collect_ctx ctx;
+    Item item;
+    int query;
+    int lo;
+    int hi;
+    int i;
+
+    printf("bptree_test: create\n");
+    assert(algokit_bptree_create(NULL) == NULL);
+    tree = algokit_bptree_create(int_key_cmp);
+    assert(tree != NULL);
+    assert(algokit_bptree_size(tree) == 0);
+    query = 1;
+    assert(algokit_bptree_search(tree, &query, &item) == 1);
+    assert(algokit_bptree_remove(tree, &query, &item) == 1);
+    assert(algokit_bptree_search(tree, &query, NULL) == -1);
+
+    printf("bptree_test: insert and search\n");
+    /* Keys are heap-allocated and freed on removal, so a stale separator would be a use after free. */
+    for (i = 0; i < KEY_COUNT; i++) {
+        int value = (int)(((size_t)i * 7919) % KEY_COUNT);
+        item.key = new_key(value);
+        item.val = item.key;
+        assert(algokit_bptree_insert(tree, item) == 0);
+        present[value] = 1;
+    }
+    query = 42;
+    item.key = &query;
+    assert(algokit_bptree_insert(tree, item) == 1);
+    for (i = 0; i < KEY_COUNT; i++) {
+        assert(algokit_bptree_search(tree, &i, &item) == 0 && *(int *)item.key == i && item.val == item.key);
+    }
+    query = KEY_COUNT;
+    assert(algokit_bptree_search(tree, &query, &item) == 1);
+    check_contents(tree, present, buffer);
+
+    printf("bptree_test: range\n");
+    ctx.out = buffer;
+    ctx.count = 0;
+    lo = 100;
+    hi = 1099;
+    assert(algokit_bptree_range(tree, &lo, &hi, collect_keys, &ctx) == 0);
+    assert(ctx.count == 1000 && buffer[0] == 100 && buffer[999] == 1099);
+    ctx.count = 0;
+    assert(algokit_bptree_range(tree, NULL, &lo, collect_keys, &ctx) == 0);
+    assert(ctx.count == 101 && buffer[0] == 0);
+    ctx.count = 0;
+    assert(algokit_bptree_range(tree, &hi, NULL, collect_keys, &ctx) == 0);
+    assert(ctx.count == KEY_COUNT - 1099 && buffer[ctx.count - 1] == KEY_COUNT - 1);
+    ctx.count = 0;
+    assert(algokit_bptree_range(tree, &hi, &lo, collect_keys, &ctx) == 0);
+    assert(ctx.count == 0);
+    assert(algokit_bptree_range(tree, &lo, &hi, NULL, &ctx) == -1);
+
+    printf("bptree_test: remove\n");
+    /* Remove every third key, then every key in a scrambled order, checking contents along the way. */
+    for (i = 0; i < KEY_COUNT; i += 3) {
+        assert(algokit_bptree_remove(tree, &i, &item) == 0 && *(int *)item.key == i);
+        free(item.key);
+        present[i] = 0;
+        assert(algokit_bptree_search(tree, &i, &item) == 1);
+    }
+    check_contents(tree, present, buffer);
+    for (i = 0; i < KEY_COUNT; i++) {
+        int value = (int)(((size_t)i * 4001) % KEY_COUNT);
+        int rc = algokit_bptree_remove(tree, &value, &item);
+        assert(rc == (present[value] ? 0 : 1));
+        if (rc == 0) {
+            free(item.key);
+            present[value] = 0;
+        }
+        if (i % 500 == 0) {
+            check_contents(tree, present, buffer);
+        }
+    }
+    assert(algokit_bptree_size(tree) == 0);
+    ctx.count = 0;
+    assert(algokit_bptree_traverse_inorder(tree, collect_keys, &ctx) == 0 && ctx.count == 0);
+
+    printf("bptree_test: churn and destroy with callback\n");
+    /* Interleave inserts and removes so nodes split, merge and borrow repeatedly. */
+    for (i = 0; i < 4 * KEY_COUNT; i++) {
+        int value = (int)(((size_t)i * 2654435761u) % KEY_COUNT);
+        if (present[value]) {
+            assert(algokit_bptree_remove(tree, &value, &item) == 0);
+            free(item.key);
+            present[value] = 0;
+        } else {
+            item.key = new_key(value);
+            item.val = NULL;
+            assert(algokit_bptree_insert(tree, item) == 0);
+            present[value] = 1;
+        }
+    }
+    check_contents(tree, present, buffer);
+    destroyed = 0;
+    algokit_bptree_destroy(tree, free_key);
+    for (i = 0, lo = 0; i < KEY_COUNT; i++) {
+        lo += present[i];
+    }
+    assert(destroyed == (size_t)lo);
+    algokit_bptree_destroy(NULL, NULL);
+
+    printf("bptree_test: ok\n");
+    return 0;
+}
@@ -4,6 +4,8 @@
 
 #include "algokit/bst.h"
 
+#define CHURN_COUNT 2000
+
 static int int_key_cmp(const void *a, const void *b) {
     int va = *(const int *)a;
     int vb = *(const int *)b;
@@ -20,6 +22,14 @@ static void collect_keys(const Item *item, void *ctx) {
     c->out[c->count++] = *(int *)item->key;
 }
 
+static size_t destroyed;
+
+static void count_destroy(void *key, void *val) {
+    (void)key;
+    (void)val;
+    destroyed++;
+}
+
 static int is_sorted(const int *values, size_t n) {
     size_t i;
     for (i = 1; i < n; i++) {
@@ -39,6 +49,8 @@ int main(void) {
     int removed_key;
     int ordered[5];
     struct collect_ctx ctx;
+    static int many[CHURN_COUNT];
+    static int many_ordered[CHURN_COUNT];
 
     printf("bst_test: create\n");
     assert(tree != NULL);
@@ -72,6 +84,34 @@ int main(void) {
 
     printf("bst_test: destroy\n");
     algokit_bst_destroy(tree, NULL);
+
+    printf("bst_test: churn\n");
+    /* Removed nodes return to the tree's pool and are reused by later inserts. */
+    tree = algokit_bst_create(int_key_cmp);
+    assert(tree != NULL);
+    for (i = 0; i < CHURN_COUNT; i++) {
+        many[i] = (int)((i * 7919) % CHURN_COUNT);
+        item.key = &many[i];
+        item.val = NULL;
+        assert(algokit_bst_insert(tree, item) == 0);
+    }
+    for (i = 0; i < CHURN_COUNT; i += 2) {
+        assert(algokit_bst_remove(tree, &many[i], &item) == 0);
+    }
+    for (i = 0; i < CHURN_COUNT; i += 2) {
+        item.key = &many[i];
+        assert(algokit_bst_insert(tree, item) == 0);
+    }
+    ctx.out = many_ordered;
+    ctx.count = 0;
+    assert(algokit_bst_traverse_inorder(tree, collect_keys, &ctx) == 0);
+    assert(ctx.count == CHURN_COUNT);
+    assert(is_sorted(many_ordered, ctx.count));
+
+    printf("bst_test: destroy with callback\n");
+    destroyed = 0;
+    algokit_bst_destroy(tree, count_destroy);
+    assert(destroyed == CHURN_COUNT);
     printf("bst_test: ok\n");
     return 0;
 }
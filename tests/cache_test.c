@@ -0,0 +1,129 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "algokit/cache.h"
+#include "algokit/key.h"
+
+#define KEY_COUNT 64
+
+static uint64_t evicted[KEY_COUNT * 4];
+static size_t evicted_count;
+
+static void record_evict(void *key, void *val) {
+    (void)val;
+    evicted[evicted_count++] = *(const uint64_t *)key;
+}
+
+static Item make_item(uint64_t *key) {
+    Item item;
+
+    item.key = key;
+    item.val = key;
+    return item;
+}
+
+int main(void) {
+    static uint64_t keys[KEY_COUNT];
+    algokit_cache *cache;
+    algokit_cache_stats stats;
+    Item out;
+    size_t hits;
+    size_t i;
+    int rc;
+
+    for (i = 0; i < KEY_COUNT; i++) {
+        keys[i] = i;
+    }
+
+    printf("cache_test: create\n");
+    assert(algokit_cache_create(0, ALGOKIT_CACHE_LRU, algokit_key_hash_u64, algokit_key_cmp_u64, NULL) == NULL);
+    assert(algokit_cache_create(4, 7, algokit_key_hash_u64, algokit_key_cmp_u64, NULL) == NULL);
+    assert(algokit_cache_create(4, ALGOKIT_CACHE_LRU, NULL, algokit_key_cmp_u64, NULL) == NULL);
+    cache = algokit_cache_create(3, ALGOKIT_CACHE_LRU, algokit_key_hash_u64, algokit_key_cmp_u64, record_evict);
+    assert(cache != NULL);
+    assert(algokit_cache_size(cache) == 0 && algokit_cache_capacity(cache) == 3);
+    assert(algokit_cache_get(cache, &keys[0], NULL) == -1);
+
+    printf("cache_test: lru order\n");
+    assert(algokit_cache_put(cache, make_item(&keys[0])) == 0);
+    assert(algokit_cache_put(cache, make_item(&keys[1])) == 0);
+    assert(algokit_cache_put(cache, make_item(&keys[2])) == 0);
+    assert(algokit_cache_put(cache, make_item(&keys[1])) == 1);
+    /* Touch 0: 1 becomes the least recently used entry. */
+    assert(algokit_cache_get(cache, &keys[0], &out) == 0 && out.val == &keys[0]);
+    assert(algokit_cache_put(cache, make_item(&keys[3])) == 0);
+    assert(evicted_count == 1 && evicted[0] == 1);
+    assert(algokit_cache_get(cache, &keys[1], &out) == 1);
+    assert(algokit_cache_put(cache, make_item(&keys[4])) == 0);
+    assert(evicted_count == 2 && evicted[1] == 2);
+    assert(algokit_cache_size(cache) == 3);
+
+    printf("cache_test: delete\n");
+    assert(algokit_cache_delete(cache, &keys[0], &out) == 0 && out.key == &keys[0]);
+    assert(algokit_cache_delete(cache, &keys[0], &out) == 1);
+    assert(evicted_count == 2);
+    assert(algokit_cache_put(cache, make_item(&keys[5])) == 0);
+    assert(evicted_count == 2);
+    assert(algokit_cache_put(cache, make_item(&keys[6])) == 0);
+    assert(evicted_count == 3 && evicted[2] == 3);
+
+    printf("cache_test: stats\n");
+    assert(algokit_cache_get_stats(cache, NULL) == -1);
+    assert(algokit_cache_get_stats(cache, &stats) == 0);
+    assert(stats.hits == 1 && stats.misses == 1 && stats.inserts == 7 && stats.evictions == 3);
+    algokit_cache_destroy(cache, NULL);
+
+    printf("cache_test: clock second chance\n");
+    evicted_count = 0;
+    cache = algokit_cache_create(3, ALGOKIT_CACHE_CLOCK, algokit_key_hash_u64, algokit_key_cmp_u64, record_evict);
+    assert(cache != NULL);
+    assert(algokit_cache_put(cache, make_item(&keys[0])) == 0);
+    assert(algokit_cache_put(cache, make_item(&keys[1])) == 0);
+    assert(algokit_cache_put(cache, make_item(&keys[2])) == 0);
+    /* 0 and 2 were referenced, so the hand skips them and evicts 1. */
+    assert(algokit_cache_get(cache, &keys[0], &out) == 0);
+    assert(algokit_cache_get(cache, &keys[2], &out) == 0);
+    assert(algokit_cache_put(cache, make_item(&keys[3])) == 0);
+    assert(evicted_count == 1 && evicted[0] == 1);
+    /* The hand cleared 0's bit on its first sweep; 2 still has its bit, so 0 goes next. */
+    assert(algokit_cache_put(cache, make_item(&keys[4])) == 0);
+    assert(evicted_count == 2 && evicted[1] == 0);
+    assert(algokit_cache_get(cache, &keys[0], &out) == 1);
+    assert(algokit_cache_get(cache, &keys[2], &out) == 0);
+    assert(algokit_cache_get(cache, &keys[3], &out) == 0);
+    assert(algokit_cache_get(cache, &keys[4], &out) == 0);
+    algokit_cache_destroy(cache, NULL);
+
+    printf("cache_test: churn and destroy\n");
+    /* Every insert beyond capacity evicts exactly one entry; destroy hands back the rest. */
+    for (i = 0; i < 2; i++) {
+        size_t j;
+
+        evicted_count = 0;
+        cache = algokit_cache_create(8, i == 0 ? ALGOKIT_CACHE_LRU : ALGOKIT_CACHE_CLOCK, algokit_key_hash_u64,
+                                     algokit_key_cmp_u64, record_evict);
+        assert(cache != NULL);
+        for (j = 0; j < KEY_COUNT; j++) {
+            assert(algokit_cache_put(cache, make_item(&keys[j])) == 0);
+            if (j % 3 == 0) {
+                assert(algokit_cache_get(cache, &keys[j], &out) == 0);
+            }
+            assert(algokit_cache_size(cache) == (j < 8 ? j + 1 : 8));
+        }
+        assert(evicted_count == KEY_COUNT - 8);
+        /* LRU keeps exactly the last 8 keys; CLOCK may keep older referenced ones instead. */
+        for (j = 0, hits = 0; j < KEY_COUNT; j++) {
+            rc = algokit_cache_get(cache, &keys[j], &out);
+            assert(rc == 0 || rc == 1);
+            assert(i == 1 || rc == (j >= KEY_COUNT - 8 ? 0 : 1));
+            hits += rc == 0;
+        }
+        assert(hits == 8);
+        algokit_cache_destroy(cache, record_evict);
+        assert(evicted_count == KEY_COUNT);
+    }
+
+    printf("cache_test: ok\n");
+    return 0;
+}
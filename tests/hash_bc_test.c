@@ -0,0 +1,179 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "algokit/hash.h"
+#include "../src/hash_internal.h"
+
+#define KEY_COUNT 5000
+
+static size_t int_hash(const void *key) {
+    return (size_t)(*(const int *)key * 2654435761u);
+}
+
+/* Every key lands in the same bucket: exercises long overflow chains. */
+static size_t bad_hash(const void *key) {
+    (void)key;
+    return 42;
+}
+
+static int int_cmp(const void *a, const void *b) {
+    int va = *(const int *)a;
+    int vb = *(const int *)b;
+    return (va > vb) - (va < vb);
+}
+
+static int fail_slabs;
+
+/* Slab allocator for the tables under test: while fail_slabs is set, every new slab fails. */
+static void *test_slab(size_t bytes) {
+    return fail_slabs ? NULL : malloc(bytes);
+}
+
+static void destroy_kv(void *key, void *val) {
+    free(key);
+    free(val);
+}
+
+int main(void) {
+    algokit_hash_bc *table = algokit_hash_bc_create(8, int_hash, int_cmp);
+    static int keys[KEY_COUNT];
+    Item item;
+    int *key;
+    int *val;
+    int query;
+    int i;
+
+    printf("hash_bc_test: create\n");
+    assert(table != NULL);
+    assert(algokit_hash_bc_create(0, int_hash, int_cmp) == NULL);
+
+    key = (int *)malloc(sizeof(*key));
+    val = (int *)malloc(sizeof(*val));
+    assert(key && val);
+    *key = 5;
+    *val = 55;
+    item.key = key;
+    item.val = val;
+    assert(algokit_hash_bc_put(table, item) == 0);
+    assert(algokit_hash_bc_put(table, item) == 1);
+
+    key = (int *)malloc(sizeof(*key));
+    val = (int *)malloc(sizeof(*val));
+    assert(key && val);
+    *key = 6;
+    *val = 66;
+    item.key = key;
+    item.val = val;
+    assert(algokit_hash_bc_put(table, item) == 0);
+
+    printf("hash_bc_test: get\n");
+    query = 6;
+    assert(algokit_hash_bc_get(table, &query, &item) == 0);
+    assert(*(int *)item.val == 66);
+    query = 7;
+    assert(algokit_hash_bc_get(table, &query, &item) == 1);
+
+    printf("hash_bc_test: delete\n");
+    query = 5;
+    assert(algokit_hash_bc_delete(table, &query, &item) == 0);
+    assert(*(int *)item.val == 55);
+    destroy_kv(item.key, item.val);
+    assert(algokit_hash_bc_delete(table, &query, &item) == 1);
+
+    printf("hash_bc_test: destroy\n");
+    algokit_hash_bc_destroy(table, destroy_kv);
+
+    printf("hash_bc_test: grow and churn\n");
+    table = algokit_hash_bc_create(16, int_hash, int_cmp);
+    assert(table != NULL);
+    for (i = 0; i < KEY_COUNT; i++) {
+        keys[i] = i * 7;
+        item.key = &keys[i];
+        item.val = NULL;
+        assert(algokit_hash_bc_put(table, item) == 0);
+    }
+    for (i = 0; i < KEY_COUNT; i += 2) {
+        assert(algokit_hash_bc_delete(table, &keys[i], &item) == 0);
+    }
+    for (i = 0; i < KEY_COUNT; i++) {
+        assert(algokit_hash_bc_get(table, &keys[i], &item) == (i % 2 == 0 ? 1 : 0));
+    }
+    for (i = 0; i < KEY_COUNT; i += 2) {
+        item.key = &keys[i];
+        assert(algokit_hash_bc_put(table, item) == 0);
+    }
+    for (i = 0; i < KEY_COUNT; i++) {
+        assert(algokit_hash_bc_get(table, &keys[i], &item) == 0);
+        assert(item.key == &keys[i]);
+    }
+    algokit_hash_bc_destroy(table, NULL);
+
+    printf("hash_bc_test: collisions\n");
+    table = algokit_hash_bc_create(16, bad_hash, int_cmp);
+    assert(table != NULL);
+    for (i = 0; i < 200; i++) {
+        item.key = &keys[i];
+        assert(algokit_hash_bc_put(table, item) == 0);
+    }
+    for (i = 0; i < 200; i += 3) {
+        assert(algokit_hash_bc_delete(table, &keys[i], &item) == 0);
+    }
+    for (i = 0; i < 200; i++) {
+        assert(algokit_hash_bc_get(table, &keys[i], &item) == (i % 3 == 0 ? 1 : 0));
+    }
+    algokit_hash_bc_destroy(table, NULL);
+
+    printf("hash_bc_test: failed resize keeps the table\n");
+    /*
+     * One chain of 256 items fills most of the first 128-block slab; the
+     * resize at the next put needs a second slab for the new chain while the
+     * old one is still in place.
+     */
+    table = algokit_hash_bc_create_with(16, bad_hash, int_cmp, test_slab);
+    assert(table != NULL);
+    for (i = 0; i < 256; i++) {
+        item.key = &keys[i];
+        assert(algokit_hash_bc_put(table, item) == 0);
+    }
+    fail_slabs = 1;
+    item.key = &keys[256];
+    assert(algokit_hash_bc_put(table, item) == -1);
+    fail_slabs = 0;
+    for (i = 0; i < 257; i++) {
+        assert(algokit_hash_bc_get(table, &keys[i], &item) == (i < 256 ? 0 : 1));
+    }
+    item.key = &keys[256];
+    assert(algokit_hash_bc_put(table, item) == 0);
+    for (i = 0; i < 257; i++) {
+        assert(algokit_hash_bc_delete(table, &keys[i], &item) == 0 && item.key == &keys[i]);
+    }
+    algokit_hash_bc_destroy(table, NULL);
+
+    printf("hash_bc_test: shrink and churn\n");
+    table = algokit_hash_bc_create(16, int_hash, int_cmp);
+    assert(table != NULL);
+    for (i = 0; i < KEY_COUNT; i++) {
+        item.key = &keys[i];
+        assert(algokit_hash_bc_put(table, item) == 0);
+    }
+    for (i = 0; i < KEY_COUNT - 10; i++) {
+        assert(algokit_hash_bc_delete(table, &keys[i], &item) == 0);
+        assert(item.key == &keys[i]);
+    }
+    for (i = 0; i < 1000; i++) {
+        int k = KEY_COUNT - 10 - 1 - (i / 2) % 20;
+        if (i % 2 == 0) {
+            item.key = &keys[k];
+            assert(algokit_hash_bc_put(table, item) == 0);
+        } else {
+            assert(algokit_hash_bc_delete(table, &keys[k], &item) == 0);
+        }
+    }
+    for (i = 0; i < KEY_COUNT; i++) {
+        assert(algokit_hash_bc_get(table, &keys[i], &item) == (i >= KEY_COUNT - 10 ? 0 : 1));
+    }
+    algokit_hash_bc_destroy(table, NULL);
+    printf("hash_bc_test: ok\n");
+    return 0;
+}
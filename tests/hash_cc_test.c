@@ -0,0 +1,367 @@
+#define _POSIX_C_SOURCE 200112L
+
+#include <assert.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "algokit/hash_cc.h"
+
+#define THREADS 4
+#define PER_THREAD 5000
+#define STRESS_KEYS 256
+#define STRESS_ROUNDS 20000
+#define STALL_KEY 7
+
+static size_t int_hash(const void *key) {
+    return (size_t)(*(const int *)key * 2654435761u);
+}
+
+static size_t hash_calls;
+
+static size_t counting_hash(const void *key) {
+    hash_calls++;
+    return int_hash(key);
+}
+
+static int int_cmp(const void *a, const void *b) {
+    int va = *(const int *)a;
+    int vb = *(const int *)b;
+    return (va > vb) - (va < vb);
+}
+
+static void destroy_kv(void *key, void *val) {
+    free(key);
+    free(val);
+}
+
+/* Retire and destroy callbacks for keys that are their own value; freed counts both. */
+static pthread_mutex_t freed_lock = PTHREAD_MUTEX_INITIALIZER;
+static size_t freed;
+static int stall_key_freed;
+
+static void free_key(void *key, void *val) {
+    (void)val;
+    pthread_mutex_lock(&freed_lock);
+    freed++;
+    if (*(int *)key == STALL_KEY) {
+        stall_key_freed = 1;
+    }
+    pthread_mutex_unlock(&freed_lock);
+    free(key);
+}
+
+static int *new_key(int value) {
+    int *key = (int *)malloc(sizeof(*key));
+
+    assert(key != NULL);
+    *key = value;
+    return key;
+}
+
+/* The first cmp on STALL_KEY while armed blocks until the test releases it. */
+static pthread_mutex_t stall_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t stall_cond = PTHREAD_COND_INITIALIZER;
+static int stall_armed;
+static int stall_entered;
+static int stall_released;
+
+static int stalling_cmp(const void *a, const void *b) {
+    int stall = 0;
+
+    if (*(const int *)a == STALL_KEY) {
+        pthread_mutex_lock(&stall_lock);
+        stall = stall_armed;
+        stall_armed = 0;
+        if (stall) {
+            stall_entered = 1;
+            pthread_cond_broadcast(&stall_cond);
+            while (!stall_released) {
+                pthread_cond_wait(&stall_cond, &stall_lock);
+            }
+        }
+        pthread_mutex_unlock(&stall_lock);
+    }
+    return int_cmp(a, b);
+}
+
+struct worker {
+    algokit_hash_cc *table;
+    int *keys;
+};
+
+/* Each thread inserts its own key range, reads it back without locks, and deletes every other key. */
+static void *worker_run(void *arg) {
+    struct worker *w = (struct worker *)arg;
+    algokit_hash_cc_reader *reader = algokit_hash_cc_reader_create(w->table);
+    Item item;
+    int i;
+
+    assert(reader != NULL);
+    for (i = 0; i < PER_THREAD; i++) {
+        item.key = &w->keys[i];
+        item.val = NULL;
+        assert(algokit_hash_cc_put(w->table, item) == 0);
+    }
+    for (i = 0; i < PER_THREAD; i++) {
+        assert(algokit_hash_cc_get(w->table, reader, &w->keys[i], &item) == 0);
+        assert(item.key == &w->keys[i]);
+    }
+    for (i = 0; i < PER_THREAD; i += 2) {
+        assert(algokit_hash_cc_delete(w->table, &w->keys[i], &item) == 0);
+    }
+    algokit_hash_cc_reader_destroy(w->table, reader);
+    return NULL;
+}
+
+/* Stalls inside get on STALL_KEY; whatever it returns must still be readable. */
+static void *stalled_reader_run(void *arg) {
+    algokit_hash_cc *table = (algokit_hash_cc *)arg;
+    algokit_hash_cc_reader *reader = algokit_hash_cc_reader_create(table);
+    int query = STALL_KEY;
+    Item item;
+
+    assert(reader != NULL);
+    algokit_hash_cc_reader_enter(table, reader);
+    if (algokit_hash_cc_get(table, reader, &query, &item) == 0) {
+        assert(*(int *)item.key == STALL_KEY);
+    }
+    algokit_hash_cc_reader_leave(table, reader);
+    algokit_hash_cc_reader_destroy(table, reader);
+    return NULL;
+}
+
+struct stress {
+    algokit_hash_cc *table;
+    int writer;
+    unsigned seed;
+};
+
+/*
+ * Writers replace their half of the keys with fresh heap copies while
+ * readers look keys up; a key freed too early shows up as a wrong value or
+ * as a use after free under AddressSanitizer.
+ */
+static void *stress_run(void *arg) {
+    struct stress *s = (struct stress *)arg;
+    algokit_hash_cc_reader *reader = algokit_hash_cc_reader_create(s->table);
+    Item item;
+    int i;
+
+    assert(reader != NULL);
+    for (i = 0; i < STRESS_ROUNDS; i++) {
+        int value;
+
+        s->seed = s->seed * 1103515245u + 12345u;
+        value = (int)((s->seed >> 8) % STRESS_KEYS);
+        if (s->writer > 0 && value % 2 == s->writer - 1) {
+            assert(algokit_hash_cc_delete(s->table, &value, NULL) == 0);
+            item.key = new_key(value);
+            item.val = item.key;
+            assert(algokit_hash_cc_put(s->table, item) == 0);
+        } else {
+            /* The read section keeps a key found here alive while it is checked. */
+            algokit_hash_cc_reader_enter(s->table, reader);
+            if (algokit_hash_cc_get(s->table, reader, &value, &item) == 0) {
+                assert(*(int *)item.key == value && item.val == item.key);
+            }
+            algokit_hash_cc_reader_leave(s->table, reader);
+        }
+    }
+    algokit_hash_cc_reader_destroy(s->table, reader);
+    return NULL;
+}
+
+int main(void) {
+    algokit_hash_cc *table = algokit_hash_cc_create(5, 16, int_hash, int_cmp, NULL);
+    static int keys[THREADS][PER_THREAD];
+    struct worker workers[THREADS];
+    struct stress stress[THREADS];
+    pthread_t threads[THREADS];
+    algokit_hash_cc_reader *reader;
+    Item item;
+    int *key;
+    int *val;
+    int query;
+    int t;
+    int i;
+
+    printf("hash_cc_test: create\n");
+    assert(table != NULL);
+    assert(algokit_hash_cc_shard_count(table) == 8);
+    assert(algokit_hash_cc_create(0, 16, int_hash, int_cmp, NULL) == NULL);
+    assert(algokit_hash_cc_create(4, 16, NULL, int_cmp, NULL) == NULL);
+    assert(algokit_hash_cc_reader_create(NULL) == NULL);
+
+    key = (int *)malloc(sizeof(*key));
+    val = (int *)malloc(sizeof(*val));
+    assert(key && val);
+    *key = 9;
+    *val = 99;
+    item.key = key;
+    item.val = val;
+    assert(algokit_hash_cc_put(table, item) == 0);
+    assert(algokit_hash_cc_put(table, item) == 1);
+    item.key = NULL;
+    assert(algokit_hash_cc_put(table, item) == -1);
+
+    printf("hash_cc_test: get\n");
+    reader = algokit_hash_cc_reader_create(table);
+    assert(reader != NULL);
+    query = 9;
+    assert(algokit_hash_cc_get(table, NULL, &query, &item) == 0);
+    assert(*(int *)item.val == 99);
+    assert(algokit_hash_cc_get(table, reader, &query, &item) == 0);
+    assert(*(int *)item.val == 99);
+    query = 10;
+    assert(algokit_hash_cc_get(table, NULL, &query, &item) == 1);
+    assert(algokit_hash_cc_get(table, reader, &query, &item) == 1);
+    assert(algokit_hash_cc_get(table, reader, NULL, &item) == -1);
+    /* Sections nest, and a leave without an enter is ignored. */
+    query = 9;
+    algokit_hash_cc_reader_enter(table, reader);
+    algokit_hash_cc_reader_enter(table, reader);
+    assert(algokit_hash_cc_get(table, reader, &query, &item) == 0);
+    algokit_hash_cc_reader_leave(table, reader);
+    assert(*(int *)item.val == 99);
+    algokit_hash_cc_reader_leave(table, reader);
+    algokit_hash_cc_reader_leave(table, reader);
+    assert(algokit_hash_cc_size(table) == 1);
+    algokit_hash_cc_reader_destroy(table, reader);
+
+    printf("hash_cc_test: delete\n");
+    query = 9;
+    assert(algokit_hash_cc_delete(table, &query, &item) == 0);
+    /* Without a retire callback the caller frees deleted items itself. */
+    destroy_kv(item.key, item.val);
+    assert(algokit_hash_cc_delete(table, &query, &item) == 1);
+    assert(algokit_hash_cc_delete(table, &query, NULL) == 1);
+    assert(algokit_hash_cc_size(table) == 0);
+
+    printf("hash_cc_test: threads\n");
+    for (t = 0; t < THREADS; t++) {
+        for (i = 0; i < PER_THREAD; i++) {
+            keys[t][i] = t * PER_THREAD + i;
+        }
+        workers[t].table = table;
+        workers[t].keys = keys[t];
+        assert(pthread_create(&threads[t], NULL, worker_run, &workers[t]) == 0);
+    }
+    for (t = 0; t < THREADS; t++) {
+        assert(pthread_join(threads[t], NULL) == 0);
+    }
+    assert(algokit_hash_cc_size(table) == THREADS * PER_THREAD / 2);
+    for (t = 0; t < THREADS; t++) {
+        for (i = 0; i < PER_THREAD; i++) {
+            assert(algokit_hash_cc_get(table, NULL, &keys[t][i], &item) == (i % 2 == 0 ? 1 : 0));
+        }
+    }
+
+    printf("hash_cc_test: destroy\n");
+    algokit_hash_cc_destroy(table, NULL);
+
+    printf("hash_cc_test: one hash per operation\n");
+    /* The shard and the slot inside it share one hash call, resizes included. */
+    table = algokit_hash_cc_create(4, 16, counting_hash, int_cmp, NULL);
+    assert(table != NULL);
+    reader = algokit_hash_cc_reader_create(table);
+    assert(reader != NULL);
+    for (i = 0; i < PER_THREAD; i++) {
+        item.key = &keys[0][i];
+        item.val = NULL;
+        assert(algokit_hash_cc_put(table, item) == 0);
+    }
+    assert(hash_calls == PER_THREAD);
+    for (i = 0; i < PER_THREAD; i++) {
+        assert(algokit_hash_cc_get(table, reader, &keys[0][i], &item) == 0 && item.key == &keys[0][i]);
+    }
+    assert(hash_calls == 2 * PER_THREAD);
+    for (i = 0; i < PER_THREAD; i++) {
+        assert(algokit_hash_cc_delete(table, &keys[0][i], &item) == 0);
+    }
+    assert(hash_calls == 3 * PER_THREAD);
+    assert(algokit_hash_cc_size(table) == 0);
+    /* destroy also frees a reader that was never unregistered. */
+    algokit_hash_cc_destroy(table, NULL);
+
+    printf("hash_cc_test: retire\n");
+    /* Deleted items reach retire in batches while the map runs; destroy hands over the rest. */
+    table = algokit_hash_cc_create(2, 16, int_hash, int_cmp, free_key);
+    assert(table != NULL);
+    for (i = 0; i < PER_THREAD; i++) {
+        item.key = new_key(i);
+        item.val = item.key;
+        assert(algokit_hash_cc_put(table, item) == 0);
+    }
+    for (i = 0; i < PER_THREAD; i++) {
+        assert(algokit_hash_cc_delete(table, &i, NULL) == 0);
+    }
+    assert(freed > 0 && freed < PER_THREAD);
+    algokit_hash_cc_destroy(table, free_key);
+    assert(freed == PER_THREAD);
+
+    printf("hash_cc_test: stalled reader\n");
+    /* A reader stuck inside get holds back every reclamation, but never blocks writers. */
+    freed = 0;
+    stall_key_freed = 0;
+    table = algokit_hash_cc_create(1, 16, int_hash, stalling_cmp, free_key);
+    assert(table != NULL);
+    for (i = 0; i < PER_THREAD; i++) {
+        item.key = new_key(i);
+        item.val = item.key;
+        assert(algokit_hash_cc_put(table, item) == 0);
+    }
+    stall_armed = 1;
+    assert(pthread_create(&threads[0], NULL, stalled_reader_run, table) == 0);
+    pthread_mutex_lock(&stall_lock);
+    while (!stall_entered) {
+        pthread_cond_wait(&stall_cond, &stall_lock);
+    }
+    pthread_mutex_unlock(&stall_lock);
+    for (i = 0; i < PER_THREAD; i++) {
+        assert(algokit_hash_cc_delete(table, &i, NULL) == 0);
+    }
+    assert(freed == 0);
+    pthread_mutex_lock(&stall_lock);
+    stall_released = 1;
+    pthread_cond_broadcast(&stall_cond);
+    pthread_mutex_unlock(&stall_lock);
+    assert(pthread_join(threads[0], NULL) == 0);
+    /* Once the reader has left, later writes reclaim the key. */
+    for (i = 0; i < PER_THREAD && !stall_key_freed; i++) {
+        item.key = new_key(i);
+        item.val = item.key;
+        assert(algokit_hash_cc_put(table, item) == 0);
+        assert(algokit_hash_cc_delete(table, &i, NULL) == 0);
+    }
+    assert(stall_key_freed);
+    algokit_hash_cc_destroy(table, free_key);
+    assert(freed == PER_THREAD + (size_t)i);
+
+    printf("hash_cc_test: readers and writers\n");
+    freed = 0;
+    table = algokit_hash_cc_create(4, STRESS_KEYS, int_hash, int_cmp, free_key);
+    assert(table != NULL);
+    for (i = 0; i < STRESS_KEYS; i++) {
+        item.key = new_key(i);
+        item.val = item.key;
+        assert(algokit_hash_cc_put(table, item) == 0);
+    }
+    for (t = 0; t < THREADS; t++) {
+        stress[t].table = table;
+        stress[t].writer = t < 2 ? t + 1 : 0;
+        stress[t].seed = 2463534242u + (unsigned)t * 7919u;
+        assert(pthread_create(&threads[t], NULL, stress_run, &stress[t]) == 0);
+    }
+    for (t = 0; t < THREADS; t++) {
+        assert(pthread_join(threads[t], NULL) == 0);
+    }
+    assert(algokit_hash_cc_size(table) == STRESS_KEYS);
+    for (i = 0; i < STRESS_KEYS; i++) {
+        assert(algokit_hash_cc_get(table, NULL, &i, &item) == 0 && *(int *)item.key == i);
+    }
+    algokit_hash_cc_destroy(table, free_key);
+
+    printf("hash_cc_test: ok\n");
+    return 0;
+}
@@ -0,0 +1,140 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "algokit/hash_frozen.h"
+
+#define KEY_COUNT 10000
+
+static size_t int_hash(const void *key) {
+    return (size_t)(*(const int *)key * 2654435761u);
+}
+
+/* Keys 0 and 1 share a hash: no pilot can separate them. */
+static size_t clashing_hash(const void *key) {
+    return (size_t)(*(const int *)key / 2);
+}
+
+static int int_cmp(const void *a, const void *b) {
+    int va = *(const int *)a;
+    int vb = *(const int *)b;
+    return (va > vb) - (va < vb);
+}
+
+static int destroyed;
+
+static void count_destroy(void *key, void *val) {
+    (void)key;
+    (void)val;
+    destroyed++;
+}
+
+int main(void) {
+    algokit_hash_lp *table = algokit_hash_lp_create(8, int_hash, int_cmp);
+    algokit_hash_frozen *frozen;
+    static int keys[KEY_COUNT];
+    static int vals[KEY_COUNT];
+    static unsigned char seen[KEY_COUNT];
+    unsigned char *image;
+    size_t image_size;
+    size_t index;
+    Item item;
+    int remapped;
+    int query;
+    int i;
+
+    printf("hash_frozen_test: empty\n");
+    assert(table != NULL);
+    frozen = algokit_hash_freeze(table, int_hash, int_cmp);
+    assert(frozen != NULL);
+    assert(algokit_hash_frozen_size(frozen) == 0);
+    query = 1;
+    assert(algokit_hash_frozen_get(frozen, &query, &item) == 1);
+    assert(algokit_hash_frozen_item_at(frozen, 0, &item) == -1);
+    algokit_hash_frozen_destroy(frozen, NULL);
+    assert(algokit_hash_freeze(NULL, int_hash, int_cmp) == NULL);
+    assert(algokit_hash_freeze(table, NULL, int_cmp) == NULL);
+
+    printf("hash_frozen_test: freeze\n");
+    for (i = 0; i < KEY_COUNT; i++) {
+        keys[i] = i * 7;
+        vals[i] = i;
+        item.key = &keys[i];
+        item.val = &vals[i];
+        assert(algokit_hash_lp_put(table, item) == 0);
+    }
+    frozen = algokit_hash_freeze(table, int_hash, int_cmp);
+    assert(frozen != NULL);
+    assert(algokit_hash_frozen_size(frozen) == KEY_COUNT);
+    algokit_hash_lp_destroy(table, NULL);
+
+    printf("hash_frozen_test: get\n");
+    for (i = 0; i < KEY_COUNT; i++) {
+        query = i * 7;
+        assert(algokit_hash_frozen_get(frozen, &query, &item) == 0);
+        assert(item.key == &keys[i] && *(int *)item.val == i);
+        query = i * 7 + 1;
+        assert(algokit_hash_frozen_get(frozen, &query, &item) == 1);
+    }
+    assert(algokit_hash_frozen_get(frozen, NULL, &item) == -1);
+
+    printf("hash_frozen_test: minimal and perfect\n");
+    /* Every slot 0..n-1 holds exactly one of the keys. */
+    for (i = 0; i < KEY_COUNT; i++) {
+        assert(algokit_hash_frozen_item_at(frozen, (size_t)i, &item) == 0);
+        assert(!seen[*(int *)item.val]);
+        seen[*(int *)item.val] = 1;
+    }
+    assert(algokit_hash_frozen_item_at(frozen, KEY_COUNT, &item) == -1);
+
+    printf("hash_frozen_test: image\n");
+    image_size = algokit_hash_frozen_image_size(frozen);
+    assert(image_size < KEY_COUNT * 2);
+    image = (unsigned char *)malloc(image_size);
+    assert(image != NULL);
+    assert(algokit_hash_frozen_write_image(frozen, image, image_size - 1) == -1);
+    assert(algokit_hash_frozen_write_image(frozen, image, image_size) == 0);
+    for (i = 0; i < KEY_COUNT; i++) {
+        query = i * 7;
+        assert(algokit_hash_frozen_image_index(image, image_size, int_hash(&query), &index) == 0);
+        assert(algokit_hash_frozen_item_at(frozen, index, &item) == 0);
+        assert(item.key == &keys[i]);
+    }
+    assert(algokit_hash_frozen_image_index(image, image_size - 1, int_hash(&query), &index) == -1);
+    /* Data written right after the image stays 8-byte aligned. */
+    assert(image_size % 8 == 0);
+    /* About 1% of the keys land past slot n-1 and go through the remap entries after the pilots. */
+    memset(image + 32 + (KEY_COUNT / 4 + 1) * 4, 0xFF, image_size - 32 - (KEY_COUNT / 4 + 1) * 4);
+    remapped = 0;
+    for (i = 0; i < KEY_COUNT; i++) {
+        int key = i * 7;
+        int rc = algokit_hash_frozen_image_index(image, image_size, int_hash(&key), &index);
+
+        assert(rc == -1 || (rc == 0 && index < KEY_COUNT));
+        remapped += rc == -1;
+    }
+    assert(remapped > 0 && remapped < KEY_COUNT / 20);
+    image[0] ^= 0xFF;
+    assert(algokit_hash_frozen_image_index(image, image_size, int_hash(&query), &index) == -1);
+    free(image);
+
+    printf("hash_frozen_test: destroy\n");
+    destroyed = 0;
+    algokit_hash_frozen_destroy(frozen, count_destroy);
+    assert(destroyed == KEY_COUNT);
+
+    printf("hash_frozen_test: equal hashes\n");
+    table = algokit_hash_lp_create(8, clashing_hash, int_cmp);
+    assert(table != NULL);
+    for (i = 0; i < 2; i++) {
+        keys[i] = i;
+        item.key = &keys[i];
+        assert(algokit_hash_lp_put(table, item) == 0);
+    }
+    assert(algokit_hash_freeze(table, clashing_hash, int_cmp) == NULL);
+    algokit_hash_lp_destroy(table, NULL);
+
+    printf("hash_frozen_test: ok\n");
+    return 0;
+}
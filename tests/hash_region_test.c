@@ -0,0 +1,125 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "algokit/hash_region.h"
+
+#define KEY_COUNT 3000
+
+struct record {
+    uint64_t id;
+    double score;
+};
+
+int main(void) {
+    size_t size = algokit_hash_region_bytes(KEY_COUNT, KEY_COUNT * 48);
+    uint64_t *buffer = (uint64_t *)malloc(size);
+    uint64_t *copy = (uint64_t *)malloc(size);
+    algokit_hash_region *region;
+    const algokit_hash_region *reader;
+    struct record rec;
+    const void *val;
+    size_t val_len;
+    uint64_t *slots;
+    size_t slot_count;
+    size_t s;
+    char key[32];
+    int i;
+
+    printf("hash_region_test: init\n");
+    assert(buffer && copy);
+    assert(algokit_hash_region_bytes(0, 10) == 0);
+    assert(algokit_hash_region_init(buffer, 16, KEY_COUNT) == NULL);
+    assert(algokit_hash_region_init((char *)buffer + 1, size - 1, KEY_COUNT) == NULL);
+    region = algokit_hash_region_init(buffer, size, KEY_COUNT);
+    assert(region != NULL);
+    assert(algokit_hash_region_count(region) == 0);
+
+    printf("hash_region_test: put and get\n");
+    assert(algokit_hash_region_put(region, "alpha", 5, "one", 4) == 0);
+    assert(algokit_hash_region_put(region, "alpha", 5, "two", 4) == 1);
+    assert(algokit_hash_region_put(region, "", 0, NULL, 0) == 0);
+    assert(algokit_hash_region_get(region, "alpha", 5, &val, &val_len) == 0);
+    assert(val_len == 4 && strcmp((const char *)val, "one") == 0);
+    assert(algokit_hash_region_get(region, "", 0, &val, &val_len) == 0 && val_len == 0);
+    assert(algokit_hash_region_get(region, "alph", 4, &val, &val_len) == 1);
+
+    printf("hash_region_test: fill\n");
+    for (i = 0; i < KEY_COUNT - 2; i++) {
+        rec.id = (uint64_t)i;
+        rec.score = i * 0.5;
+        sprintf(key, "record-%d", i);
+        assert(algokit_hash_region_put(region, key, strlen(key), &rec, sizeof(rec)) == 0);
+    }
+    assert(algokit_hash_region_count(region) == KEY_COUNT);
+    /* The slot count is fixed at creation; past 3/4 of it puts are refused. */
+    for (i = KEY_COUNT; algokit_hash_region_put(region, key, (size_t)sprintf(key, "extra-%d", i), &rec, 8) == 0; i++) {
+    }
+    assert(algokit_hash_region_put(region, key, strlen(key), &rec, 8) == -1);
+
+    printf("hash_region_test: seal and open\n");
+    assert(algokit_hash_region_open(buffer, size) == NULL);
+    assert(algokit_hash_region_seal(region) == 0);
+    assert(algokit_hash_region_put(region, "late", 4, "x", 1) == -1);
+    assert(algokit_hash_region_open(buffer, 16) == NULL);
+
+    printf("hash_region_test: relocated copy\n");
+    /* A byte copy at another address is a complete, working table. */
+    memcpy(copy, buffer, size);
+    memset(buffer, 0, size);
+    reader = algokit_hash_region_open(copy, size);
+    assert(reader != NULL);
+    assert(algokit_hash_region_open(buffer, size) == NULL);
+    for (i = 0; i < KEY_COUNT - 2; i++) {
+        sprintf(key, "record-%d", i);
+        assert(algokit_hash_region_get(reader, key, strlen(key), &val, &val_len) == 0);
+        assert(val_len == sizeof(rec) && ((uintptr_t)val & 7) == 0);
+        assert(((const struct record *)val)->id == (uint64_t)i);
+        assert(((const struct record *)val)->score == i * 0.5);
+    }
+    assert(algokit_hash_region_get(reader, "alpha", 5, &val, &val_len) == 0);
+    assert(strcmp((const char *)val, "one") == 0);
+    assert(algokit_hash_region_get(reader, "record-x", 8, &val, &val_len) == 1);
+
+    printf("hash_region_test: corrupt slots\n");
+    /* The layout is a 7-word header, then 4 words per slot: hash, key_off, val_off, lengths. */
+    slots = copy + 7;
+    slot_count = (size_t)copy[2];
+    for (s = 0; s < slot_count; s++) {
+        if (slots[4 * s + 1] != 0) {
+            slots[4 * s + 2] = (uint64_t)size;
+        }
+    }
+    assert(algokit_hash_region_open(copy, size) == reader);
+    assert(algokit_hash_region_get(reader, "alpha", 5, &val, &val_len) == -1);
+    for (s = 0; s < slot_count; s++) {
+        if (slots[4 * s + 1] != 0) {
+            slots[4 * s + 1] = UINT64_MAX - 1;
+        }
+    }
+    assert(algokit_hash_region_get(reader, "alpha", 5, &val, &val_len) == -1);
+    /* No empty slot left: a miss must still stop after one lap. */
+    for (s = 0; s < slot_count; s++) {
+        slots[4 * s] = 0;
+        slots[4 * s + 1] = 1;
+    }
+    assert(algokit_hash_region_get(reader, "record-x", 8, &val, &val_len) == -1);
+    copy[5] = 0;
+    assert(algokit_hash_region_open(copy, size) == NULL);
+
+    printf("hash_region_test: data area full\n");
+    /* Keys and values are each padded to 8 bytes: 32 data bytes hold two small entries. */
+    region = algokit_hash_region_init(buffer, algokit_hash_region_bytes(10, 32), 10);
+    assert(region != NULL);
+    assert(algokit_hash_region_put(region, "k1", 2, "v1", 2) == 0);
+    assert(algokit_hash_region_put(region, "k2", 2, "v2", 2) == 0);
+    assert(algokit_hash_region_put(region, "k3", 2, "v3", 2) == -1);
+    assert(algokit_hash_region_get(region, "k2", 2, &val, &val_len) == 0 && memcmp(val, "v2", 2) == 0);
+
+    free(buffer);
+    free(copy);
+    printf("hash_region_test: ok\n");
+    return 0;
+}
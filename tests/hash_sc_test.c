@@ -3,6 +3,12 @@
 #include <stdlib.h>
 
 #include "algokit/hash.h"
+#include "../src/hash_internal.h"
+
+#define KEY_COUNT 1000
+
+static size_t hash_calls;
+static size_t cmp_calls;
 
 static size_t int_hash(const void *key) {
     return (size_t)(*(const int *)key * 2654435761u);
@@ -14,6 +20,35 @@ static int int_cmp(const void *a, const void *b) {
     return (va > vb) - (va < vb);
 }
 
+/* Distinct keys get distinct hashes, so cached hashes should filter every mismatch. */
+static size_t counting_hash(const void *key) {
+    hash_calls++;
+    return int_hash(key);
+}
+
+static int counting_cmp(const void *a, const void *b) {
+    cmp_calls++;
+    return int_cmp(a, b);
+}
+
+/* Low bits are always zero: hash % capacity would put every key in one slot. */
+static size_t shifted_hash(const void *key) {
+    return (size_t)*(const int *)key << 12;
+}
+
+/* Every key lands in the same place: lookups degrade to a linear scan. */
+static size_t constant_hash(const void *key) {
+    (void)key;
+    return 42;
+}
+
+static int fail_slabs;
+
+/* Slab allocator for the tables under test: while fail_slabs is set, every new slab fails. */
+static void *test_slab(size_t bytes) {
+    return fail_slabs ? NULL : malloc(bytes);
+}
+
 static void destroy_kv(void *key, void *val) {
     free(key);
     free(val);
@@ -25,6 +60,19 @@ int main(void) {
     int *key;
     int *val;
     int query;
+    static int keys[KEY_COUNT];
+    static Item batch_items[KEY_COUNT];
+    static const void *batch_keys[KEY_COUNT + 2];
+    static Item batch_out[KEY_COUNT + 2];
+    static int results[KEY_COUNT + 2];
+    static char seen[KEY_COUNT];
+    algokit_hash_cursor cursor;
+    algokit_hash_stats stats;
+    size_t histogram_total;
+    size_t capacity;
+    size_t visited;
+    int rc;
+    int i;
 
     printf("hash_sc_test: create\n");
     assert(table != NULL);
@@ -60,6 +108,225 @@ int main(void) {
 
     printf("hash_sc_test: destroy\n");
     algokit_hash_sc_destroy(table, destroy_kv);
+
+    printf("hash_sc_test: cached hashes\n");
+    table = algokit_hash_sc_create(8, counting_hash, counting_cmp);
+    assert(table != NULL);
+    for (i = 0; i < KEY_COUNT; i++) {
+        keys[i] = i * 3;
+        item.key = &keys[i];
+        item.val = NULL;
+        assert(algokit_hash_sc_put(table, item) == 0);
+    }
+    /* Growing from 8 slots resized many times without calling hash again. */
+    assert(hash_calls == KEY_COUNT);
+    cmp_calls = 0;
+    for (i = 0; i < KEY_COUNT; i++) {
+        assert(algokit_hash_sc_get(table, &keys[i], &item) == 0);
+        assert(item.key == &keys[i]);
+    }
+    assert(cmp_calls == KEY_COUNT);
+    cmp_calls = 0;
+    query = 1;
+    assert(algokit_hash_sc_get(table, &query, &item) == 1);
+    assert(cmp_calls == 0);
+    hash_calls = 0;
+    for (i = 0; i < KEY_COUNT; i++) {
+        assert(algokit_hash_sc_delete(table, &keys[i], &item) == 0);
+    }
+    /* Shrinking reuses the cached hashes as well. */
+    assert(hash_calls == KEY_COUNT);
+    algokit_hash_sc_destroy(table, NULL);
+
+    printf("hash_sc_test: weak hash\n");
+    table = algokit_hash_sc_create(5, shifted_hash, int_cmp);
+    assert(table != NULL);
+    for (i = 0; i < KEY_COUNT; i++) {
+        item.key = &keys[i];
+        assert(algokit_hash_sc_put(table, item) == 0);
+    }
+    for (i = 0; i < KEY_COUNT; i++) {
+        assert(algokit_hash_sc_get(table, &keys[i], &item) == 0);
+        assert(item.key == &keys[i]);
+    }
+    algokit_hash_sc_destroy(table, NULL);
+
+    printf("hash_sc_test: batch\n");
+    table = algokit_hash_sc_create(8, int_hash, int_cmp);
+    assert(table != NULL);
+    for (i = 0; i < KEY_COUNT; i++) {
+        /* Every tenth item repeats the previous key and must be rejected. */
+        batch_items[i].key = &keys[i % 10 == 9 ? i - 1 : i];
+        batch_items[i].val = &keys[i];
+    }
+    assert(algokit_hash_sc_put_batch(table, batch_items, KEY_COUNT, results) == 0);
+    for (i = 0; i < KEY_COUNT; i++) {
+        assert(results[i] == (i % 10 == 9 ? 1 : 0));
+    }
+    for (i = 0; i < KEY_COUNT; i++) {
+        batch_keys[i] = &keys[i];
+    }
+    query = 1;
+    batch_keys[KEY_COUNT] = &query;
+    batch_keys[KEY_COUNT + 1] = NULL;
+    assert(algokit_hash_sc_get_batch(table, batch_keys, KEY_COUNT + 2, batch_out, results) != 0);
+    for (i = 0; i < KEY_COUNT; i++) {
+        assert(results[i] == (i % 10 == 9 ? 1 : 0));
+        assert(results[i] != 0 || batch_out[i].key == &keys[i]);
+    }
+    assert(results[KEY_COUNT] == 1);
+    assert(results[KEY_COUNT + 1] == -1);
+    assert(algokit_hash_sc_get_batch(table, batch_keys, KEY_COUNT, batch_out, results) == 0);
+    assert(algokit_hash_sc_get_batch(table, NULL, 0, NULL, NULL) == 0);
+    algokit_hash_sc_destroy(table, NULL);
+
+    printf("hash_sc_test: reserve\n");
+    table = algokit_hash_sc_create(8, int_hash, int_cmp);
+    assert(table != NULL);
+    assert(algokit_hash_sc_first(table, &cursor, &item) == 1);
+    assert(algokit_hash_sc_reserve(table, KEY_COUNT) == 0);
+    capacity = algokit_hash_sc_capacity(table);
+    for (i = 0; i < KEY_COUNT; i++) {
+        item.key = &keys[i];
+        assert(algokit_hash_sc_put(table, item) == 0);
+    }
+    /* The bulk load fit in the reserved capacity: no resize happened. */
+    assert(algokit_hash_sc_capacity(table) == capacity);
+    assert(algokit_hash_sc_size(table) == KEY_COUNT);
+    assert(algokit_hash_sc_reserve(table, 10) == 0);
+    assert(algokit_hash_sc_capacity(table) == capacity);
+
+    printf("hash_sc_test: cursor\n");
+    visited = 0;
+    for (rc = algokit_hash_sc_first(table, &cursor, &item); rc == 0; rc = algokit_hash_sc_next(table, &cursor, &item)) {
+        i = (int)((int *)item.key - keys);
+        assert(i >= 0 && i < KEY_COUNT && !seen[i]);
+        seen[i] = 1;
+        visited++;
+    }
+    assert(rc == 1);
+    assert(visited == KEY_COUNT);
+    assert(algokit_hash_sc_next(table, &cursor, &item) == 1);
+
+    printf("hash_sc_test: shrink and clear\n");
+    for (i = 0; i < KEY_COUNT - 10; i++) {
+        assert(algokit_hash_sc_delete(table, &keys[i], &item) == 0);
+    }
+    assert(algokit_hash_sc_shrink_to_fit(table) == 0);
+    assert(algokit_hash_sc_capacity(table) == 8);
+    for (i = 0; i < KEY_COUNT; i++) {
+        assert(algokit_hash_sc_get(table, &keys[i], &item) == (i >= KEY_COUNT - 10 ? 0 : 1));
+    }
+    algokit_hash_sc_clear(table, NULL);
+    assert(algokit_hash_sc_size(table) == 0);
+    assert(algokit_hash_sc_capacity(table) == 8);
+    assert(algokit_hash_sc_get(table, &keys[KEY_COUNT - 1], &item) == 1);
+    assert(algokit_hash_sc_first(table, &cursor, &item) == 1);
+    key = (int *)malloc(sizeof(*key));
+    val = (int *)malloc(sizeof(*val));
+    assert(key && val);
+    *key = 77;
+    item.key = key;
+    item.val = val;
+    assert(algokit_hash_sc_put(table, item) == 0);
+    algokit_hash_sc_clear(table, destroy_kv);
+    assert(algokit_hash_sc_size(table) == 0);
+    algokit_hash_sc_destroy(table, NULL);
+
+    printf("hash_sc_test: node pool\n");
+    /* Once the nodes for KEY_COUNT items exist, refilling never needs a new slab. */
+    table = algokit_hash_sc_create_with(8, int_hash, int_cmp, test_slab);
+    assert(table != NULL);
+    for (i = 0; i < KEY_COUNT; i++) {
+        item.key = &keys[i];
+        item.val = NULL;
+        assert(algokit_hash_sc_put(table, item) == 0);
+    }
+    fail_slabs = 1;
+    /* Deleted nodes are reused by later puts. */
+    for (i = 0; i < KEY_COUNT; i += 2) {
+        assert(algokit_hash_sc_delete(table, &keys[i], &item) == 0);
+    }
+    for (i = 0; i < KEY_COUNT; i += 2) {
+        item.key = &keys[i];
+        assert(algokit_hash_sc_put(table, item) == 0);
+    }
+    /* A resize relinks the nodes it has. */
+    capacity = algokit_hash_sc_capacity(table);
+    assert(algokit_hash_sc_reserve(table, 8 * KEY_COUNT) == 0);
+    assert(algokit_hash_sc_capacity(table) > capacity);
+    for (i = 0; i < KEY_COUNT; i++) {
+        assert(algokit_hash_sc_get(table, &keys[i], &item) == 0 && item.key == &keys[i]);
+    }
+    /* Clear keeps the slabs, so a bulk load after it allocates nothing. */
+    algokit_hash_sc_clear(table, NULL);
+    for (i = 0; i < KEY_COUNT; i++) {
+        item.key = &keys[i];
+        assert(algokit_hash_sc_put(table, item) == 0);
+    }
+    assert(algokit_hash_sc_size(table) == KEY_COUNT);
+    /* shrink_to_fit copies the survivors into new slabs: it fails cleanly without them. */
+    for (i = 10; i < KEY_COUNT; i++) {
+        assert(algokit_hash_sc_delete(table, &keys[i], &item) == 0);
+    }
+    capacity = algokit_hash_sc_capacity(table);
+    assert(algokit_hash_sc_shrink_to_fit(table) == -1);
+    assert(algokit_hash_sc_capacity(table) == capacity && algokit_hash_sc_size(table) == 10);
+    fail_slabs = 0;
+    assert(algokit_hash_sc_shrink_to_fit(table) == 0);
+    assert(algokit_hash_sc_capacity(table) == 8 && algokit_hash_sc_size(table) == 10);
+    for (i = 0; i < KEY_COUNT; i++) {
+        assert(algokit_hash_sc_get(table, &keys[i], &item) == (i < 10 ? 0 : 1));
+    }
+    /* Nothing left to reclaim: a second call changes nothing. */
+    assert(algokit_hash_sc_shrink_to_fit(table) == 0);
+    assert(algokit_hash_sc_capacity(table) == 8);
+    algokit_hash_sc_destroy(table, NULL);
+
+    printf("hash_sc_test: stats\n");
+    assert(algokit_hash_sc_stats(NULL, &stats) == -1);
+    table = algokit_hash_sc_create(8, int_hash, int_cmp);
+    assert(table != NULL);
+    assert(algokit_hash_sc_stats(table, NULL) == -1);
+    assert(algokit_hash_sc_stats(table, &stats) == 0);
+    assert(stats.size == 0 && stats.max_probe == 0 && stats.avg_probe == 0.0);
+    assert(stats.grow_count == 0 && stats.shrink_count == 0);
+    for (i = 0; i < KEY_COUNT; i++) {
+        item.key = &keys[i];
+        item.val = NULL;
+        assert(algokit_hash_sc_put(table, item) == 0);
+    }
+    for (i = 0; i < KEY_COUNT / 2; i++) {
+        assert(algokit_hash_sc_delete(table, &keys[i], &item) == 0);
+    }
+    assert(algokit_hash_sc_stats(table, &stats) == 0);
+    assert(stats.size == KEY_COUNT / 2);
+    assert(stats.capacity == algokit_hash_sc_capacity(table));
+    assert(stats.load_factor == (double)stats.size / (double)stats.capacity);
+    assert(stats.tombstones == 0);
+    assert(stats.grow_count > 0 && stats.shrink_count == 0);
+    assert(stats.avg_probe >= 1.0 && stats.max_probe >= 1);
+    for (i = 0, histogram_total = 0; i < ALGOKIT_HASH_STATS_HISTOGRAM; i++) {
+        histogram_total += stats.probe_histogram[i];
+    }
+    assert(histogram_total == stats.size);
+    assert(algokit_hash_sc_shrink_to_fit(table) == 0);
+    assert(algokit_hash_sc_stats(table, &stats) == 0);
+    assert(stats.tombstones == 0 && stats.shrink_count == 1);
+    algokit_hash_sc_destroy(table, NULL);
+
+    /* A constant hash shows up as probe lengths 1..n instead of a load problem. */
+    table = algokit_hash_sc_create(256, constant_hash, int_cmp);
+    assert(table != NULL);
+    for (i = 0; i < 64; i++) {
+        item.key = &keys[i];
+        assert(algokit_hash_sc_put(table, item) == 0);
+    }
+    assert(algokit_hash_sc_stats(table, &stats) == 0);
+    assert(stats.max_probe == 64 && stats.avg_probe == 32.5);
+    assert(stats.probe_histogram[0] == 1 && stats.probe_histogram[ALGOKIT_HASH_STATS_HISTOGRAM - 1] == 49);
+    assert(stats.load_factor < 0.5);
+    algokit_hash_sc_destroy(table, NULL);
     printf("hash_sc_test: ok\n");
     return 0;
 }
@@ -0,0 +1,103 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "algokit/hash_u64.h"
+
+#define KEY_COUNT 5000
+#define RANGE 4096
+
+int main(void) {
+    algokit_hash_u64 *map = algokit_hash_u64_create(8);
+    static int present[RANGE];
+    static uint64_t values[RANGE];
+    uint32_t seed = 2463534242u;
+    uint64_t val;
+    uint64_t i;
+    size_t count = 0;
+
+    printf("hash_u64_test: create\n");
+    assert(map != NULL);
+    assert(algokit_hash_u64_create(0) == NULL);
+    assert(algokit_hash_u64_size(map) == 0);
+
+    printf("hash_u64_test: put and get\n");
+    assert(algokit_hash_u64_put(map, 5, 55) == 0);
+    assert(algokit_hash_u64_put(map, 5, 56) == 1);
+    assert(algokit_hash_u64_put(map, UINT64_MAX, 66) == 0);
+    assert(algokit_hash_u64_get(map, 5, &val) == 0 && val == 55);
+    assert(algokit_hash_u64_get(map, UINT64_MAX, &val) == 0 && val == 66);
+    assert(algokit_hash_u64_get(map, 7, &val) == 1);
+    assert(algokit_hash_u64_get(map, 5, NULL) == -1);
+
+    printf("hash_u64_test: zero key\n");
+    assert(algokit_hash_u64_get(map, 0, &val) == 1);
+    assert(algokit_hash_u64_put(map, 0, 100) == 0);
+    assert(algokit_hash_u64_put(map, 0, 101) == 1);
+    assert(algokit_hash_u64_get(map, 0, &val) == 0 && val == 100);
+    assert(algokit_hash_u64_size(map) == 3);
+    assert(algokit_hash_u64_delete(map, 0, &val) == 0 && val == 100);
+    assert(algokit_hash_u64_delete(map, 0, &val) == 1);
+
+    printf("hash_u64_test: delete\n");
+    assert(algokit_hash_u64_delete(map, 5, &val) == 0 && val == 55);
+    assert(algokit_hash_u64_delete(map, 5, &val) == 1);
+    assert(algokit_hash_u64_size(map) == 1);
+    algokit_hash_u64_destroy(map);
+
+    printf("hash_u64_test: grow and shrink\n");
+    map = algokit_hash_u64_create(8);
+    assert(map != NULL);
+    for (i = 0; i < KEY_COUNT; i++) {
+        assert(algokit_hash_u64_put(map, i << 32, i) == 0);
+    }
+    for (i = 0; i < KEY_COUNT; i++) {
+        assert(algokit_hash_u64_get(map, i << 32, &val) == 0 && val == i);
+    }
+    for (i = 0; i < KEY_COUNT - 10; i++) {
+        assert(algokit_hash_u64_delete(map, i << 32, &val) == 0 && val == i);
+    }
+    assert(algokit_hash_u64_size(map) == 10);
+    for (i = 0; i < KEY_COUNT; i++) {
+        assert(algokit_hash_u64_get(map, i << 32, &val) == (i >= KEY_COUNT - 10 ? 0 : 1));
+    }
+    algokit_hash_u64_destroy(map);
+
+    printf("hash_u64_test: random churn\n");
+    /* Random puts and deletes over a small key range, checked against a plain array. */
+    map = algokit_hash_u64_create(16);
+    assert(map != NULL);
+    for (i = 0; i < 200000; i++) {
+        uint64_t key;
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        key = seed % RANGE;
+        if (seed & 0x10000u) {
+            int result = algokit_hash_u64_put(map, key, i);
+            assert(result == (present[key] ? 1 : 0));
+            if (result == 0) {
+                present[key] = 1;
+                values[key] = i;
+                count++;
+            }
+        } else {
+            int result = algokit_hash_u64_delete(map, key, &val);
+            assert(result == (present[key] ? 0 : 1));
+            if (result == 0) {
+                assert(val == values[key]);
+                present[key] = 0;
+                count--;
+            }
+        }
+        assert(algokit_hash_u64_size(map) == count);
+    }
+    for (i = 0; i < RANGE; i++) {
+        assert(algokit_hash_u64_get(map, i, &val) == (present[i] ? 0 : 1));
+        assert(!present[i] || val == values[i]);
+    }
+    algokit_hash_u64_destroy(map);
+
+    printf("hash_u64_test: ok\n");
+    return 0;
+}
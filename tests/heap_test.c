@@ -20,6 +20,8 @@ int main(void) {
     Item item;
     int *priority;
     int prev;
+    int values[] = {4, 1, 7, 3, 9, 5};
+    size_t i;
 
     printf("heap_test: create\n");
     assert(heap != NULL);
@@ -61,6 +63,31 @@ int main(void) {
 
     printf("heap_test: destroy\n");
     algokit_heap_destroy(heap, destroy_kv);
+
+    printf("heap_test: min-heap\n");
+    heap = algokit_heap_create_min(2, int_key_cmp);
+    assert(heap != NULL);
+    for (i = 0; i < 5; i++) {
+        item.key = &values[i];
+        item.val = NULL;
+        assert(algokit_heap_insert(heap, item) == 0);
+    }
+    assert(algokit_heap_peek(heap, &item) == 0);
+    assert(*(int *)item.key == 1);
+
+    printf("heap_test: replace_top\n");
+    item.key = &values[5];
+    assert(algokit_heap_replace_top(heap, item, &item) == 0);
+    assert(*(int *)item.key == 1);
+    prev = -1000;
+    while (!algokit_heap_is_empty(heap)) {
+        assert(algokit_heap_extract(heap, &item) == 0);
+        assert(*(int *)item.key >= prev);
+        prev = *(int *)item.key;
+    }
+    assert(prev == 9);
+    assert(algokit_heap_replace_top(heap, item, &item) != 0);
+    algokit_heap_destroy(heap, NULL);
     printf("heap_test: ok\n");
     return 0;
 }
@@ -0,0 +1,114 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "algokit/hash.h"
+#include "algokit/key.h"
+
+#define KEY_COUNT 1000
+
+static int popcount64(uint64_t x) {
+    int n = 0;
+    while (x) {
+        x &= x - 1;
+        n++;
+    }
+    return n;
+}
+
+int main(void) {
+    static unsigned char bytes[256];
+    static uint64_t keys[KEY_COUNT];
+    static char words[KEY_COUNT][16];
+    uint32_t a32 = 7;
+    uint32_t b32 = 9;
+    uint64_t a64 = UINT64_C(1) << 40;
+    uint64_t b64 = 3;
+    algokit_hash_lp *table;
+    Item item;
+    Item out;
+    long flipped = 0;
+    size_t i;
+    size_t len;
+
+    printf("key_test: comparators\n");
+    assert(algokit_key_cmp_u32(&a32, &b32) < 0);
+    assert(algokit_key_cmp_u32(&b32, &a32) > 0);
+    assert(algokit_key_cmp_u32(&a32, &a32) == 0);
+    assert(algokit_key_cmp_u64(&a64, &b64) > 0);
+    assert(algokit_key_cmp_u64(&b64, &a64) < 0);
+    assert(algokit_key_cmp_ptr(&bytes[0], &bytes[1]) < 0);
+    assert(algokit_key_cmp_ptr(&bytes[1], &bytes[1]) == 0);
+    assert(algokit_key_cmp_str("apple", "banana") < 0);
+    assert(algokit_key_cmp_str("pear", "pear") == 0);
+
+    printf("key_test: integer hashes\n");
+    assert(algokit_key_hash_u32(&a32) == (size_t)algokit_key_mix64(7));
+    assert(algokit_key_hash_u64(&a64) == (size_t)algokit_key_mix64(a64));
+    assert(algokit_key_hash_ptr(&bytes[0]) != algokit_key_hash_ptr(&bytes[1]));
+    /* Neighbouring integers must differ in about half of the output bits. */
+    for (i = 0; i < KEY_COUNT; i++) {
+        flipped += popcount64(algokit_key_mix64(i) ^ algokit_key_mix64(i + 1));
+    }
+    assert(flipped / KEY_COUNT >= 28 && flipped / KEY_COUNT <= 36);
+
+    printf("key_test: byte hashes\n");
+    for (i = 0; i < sizeof(bytes); i++) {
+        bytes[i] = (unsigned char)(i * 31 + 7);
+    }
+    /* Every length takes a different read path; each must be deterministic and seed-dependent. */
+    for (len = 0; len <= sizeof(bytes); len++) {
+        uint64_t h = algokit_key_hash_bytes(bytes, len, 0);
+        assert(h == algokit_key_hash_bytes(bytes, len, 0));
+        assert(h != algokit_key_hash_bytes(bytes, len, 1));
+        if (len > 0) {
+            assert(h != algokit_key_hash_bytes(bytes, len - 1, 0));
+        }
+    }
+    /* Flipping any single input bit changes about half of the output bits. */
+    flipped = 0;
+    for (i = 0; i < 64 * 8; i++) {
+        uint64_t before = algokit_key_hash_bytes(bytes, 64, 42);
+        bytes[i / 8] ^= (unsigned char)(1u << (i % 8));
+        flipped += popcount64(before ^ algokit_key_hash_bytes(bytes, 64, 42));
+        bytes[i / 8] ^= (unsigned char)(1u << (i % 8));
+    }
+    assert(flipped / (64 * 8) >= 28 && flipped / (64 * 8) <= 36);
+
+    printf("key_test: string hashes\n");
+    assert(algokit_key_hash_str("hello") == (size_t)algokit_key_hash_bytes("hello", 5, 0));
+    assert(algokit_key_hash_str("") == (size_t)algokit_key_hash_bytes("", 0, 0));
+    assert(algokit_key_hash_str("key1") != algokit_key_hash_str("key2"));
+
+    printf("key_test: hash table callbacks\n");
+    table = algokit_hash_lp_create(8, algokit_key_hash_u64, algokit_key_cmp_u64);
+    assert(table != NULL);
+    for (i = 0; i < KEY_COUNT; i++) {
+        keys[i] = (uint64_t)i << 32;
+        item.key = &keys[i];
+        item.val = NULL;
+        assert(algokit_hash_lp_put(table, item) == 0);
+    }
+    for (i = 0; i < KEY_COUNT; i++) {
+        assert(algokit_hash_lp_get(table, &keys[i], &out) == 0);
+        assert(out.key == &keys[i]);
+    }
+    algokit_hash_lp_destroy(table, NULL);
+
+    table = algokit_hash_lp_create(8, algokit_key_hash_str, algokit_key_cmp_str);
+    assert(table != NULL);
+    for (i = 0; i < KEY_COUNT; i++) {
+        sprintf(words[i], "word-%zu", i);
+        item.key = words[i];
+        item.val = NULL;
+        assert(algokit_hash_lp_put(table, item) == 0);
+    }
+    assert(algokit_hash_lp_get(table, "word-512", &out) == 0);
+    assert(out.key == words[512]);
+    assert(algokit_hash_lp_get(table, "word-1000", &out) == 1);
+    algokit_hash_lp_destroy(table, NULL);
+
+    printf("key_test: ok\n");
+    return 0;
+}
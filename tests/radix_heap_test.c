@@ -0,0 +1,90 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "algokit/radix_heap.h"
+
+static void destroy_kv(void *key, void *val) {
+    free(key);
+    free(val);
+}
+
+int main(void) {
+    algokit_radix_heap *heap = algokit_radix_heap_create();
+    uint64_t priorities[] = {40, 7, 7, 1000000, 12, 65, 3};
+    uint64_t priority;
+    uint64_t prev;
+    Item item;
+    size_t i;
+    int *id;
+
+    printf("radix_heap_test: create\n");
+    assert(heap != NULL);
+    assert(algokit_radix_heap_is_empty(heap));
+
+    printf("radix_heap_test: insert\n");
+    for (i = 0; i < sizeof(priorities) / sizeof(priorities[0]); i++) {
+        id = (int *)malloc(sizeof(*id));
+        assert(id != NULL);
+        *id = (int)i;
+        item.key = id;
+        item.val = NULL;
+        assert(algokit_radix_heap_insert(heap, priorities[i], item) == 0);
+    }
+    assert(algokit_radix_heap_size(heap) == 7);
+
+    printf("radix_heap_test: peek\n");
+    assert(algokit_radix_heap_peek_min(heap, &priority, &item) == 0);
+    assert(priority == 3);
+    assert(*(int *)item.key == 6);
+
+    printf("radix_heap_test: extract\n");
+    assert(algokit_radix_heap_extract_min(heap, &priority, &item) == 0);
+    assert(priority == 3);
+    destroy_kv(item.key, item.val);
+    assert(algokit_radix_heap_extract_min(heap, &priority, &item) == 0);
+    assert(priority == 7);
+    destroy_kv(item.key, item.val);
+    assert(algokit_radix_heap_last(heap) == 7);
+
+    printf("radix_heap_test: monotone\n");
+    item.key = NULL;
+    item.val = NULL;
+    assert(algokit_radix_heap_insert(heap, 6, item) != 0);
+    assert(algokit_radix_heap_insert(heap, 7, item) == 0);
+    assert(algokit_radix_heap_extract_min(heap, &priority, &item) == 0);
+    assert(priority == 7);
+
+    printf("radix_heap_test: interleaved\n");
+    srand(7);
+    prev = algokit_radix_heap_last(heap);
+    for (i = 0; i < 5000; i++) {
+        if (rand() % 3 != 0 || algokit_radix_heap_is_empty(heap)) {
+            item.key = NULL;
+            item.val = NULL;
+            assert(algokit_radix_heap_insert(heap, prev + (uint64_t)(rand() % 100000), item) == 0);
+        } else {
+            assert(algokit_radix_heap_extract_min(heap, &priority, &item) == 0);
+            assert(priority >= prev);
+            if (item.key) {
+                destroy_kv(item.key, item.val);
+            }
+            prev = priority;
+        }
+    }
+    while (!algokit_radix_heap_is_empty(heap)) {
+        assert(algokit_radix_heap_extract_min(heap, &priority, &item) == 0);
+        assert(priority >= prev);
+        if (item.key) {
+            destroy_kv(item.key, item.val);
+        }
+        prev = priority;
+    }
+    assert(algokit_radix_heap_extract_min(heap, &priority, &item) != 0);
+
+    printf("radix_heap_test: destroy\n");
+    algokit_radix_heap_destroy(heap, destroy_kv);
+    printf("radix_heap_test: ok\n");
+    return 0;
+}
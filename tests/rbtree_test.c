@@ -4,6 +4,8 @@
 
 #include "algokit/rbtree.h"
 
+#define CHURN_COUNT 2000
+
 static int int_key_cmp(const void *a, const void *b) {
     int va = *(const int *)a;
     int vb = *(const int *)b;
@@ -20,6 +22,14 @@ static void collect_keys(const Item *item, void *ctx) {
     c->out[c->count++] = *(int *)item->key;
 }
 
+static size_t destroyed;
+
+static void count_destroy(void *key, void *val) {
+    (void)key;
+    (void)val;
+    destroyed++;
+}
+
 static int is_sorted(const int *values, size_t n) {
     size_t i;
     for (i = 1; i < n; i++) {
@@ -39,6 +49,8 @@ int main(void) {
     int removed_key;
     int ordered[5];
     struct collect_ctx ctx;
+    static int many[CHURN_COUNT];
+    static int many_ordered[CHURN_COUNT];
 
     printf("rbtree_test: create\n");
     assert(tree != NULL);
@@ -72,6 +84,84 @@ int main(void) {
 
     printf("rbtree_test: destroy\n");
     algokit_rbtree_destroy(tree, NULL);
+
+    printf("rbtree_test: churn\n");
+    /* Removed nodes return to the tree's pool and are reused by later inserts. */
+    tree = algokit_rbtree_create(int_key_cmp);
+    assert(tree != NULL);
+    for (i = 0; i < CHURN_COUNT; i++) {
+        many[i] = (int)((i * 7919) % CHURN_COUNT);
+        item.key = &many[i];
+        item.val = NULL;
+        assert(algokit_rbtree_insert(tree, item) == 0);
+    }
+    for (i = 0; i < CHURN_COUNT; i += 2) {
+        assert(algokit_rbtree_remove(tree, &many[i], &item) == 0);
+    }
+    for (i = 0; i < CHURN_COUNT; i += 2) {
+        item.key = &many[i];
+        assert(algokit_rbtree_insert(tree, item) == 0);
+    }
+    ctx.out = many_ordered;
+    ctx.count = 0;
+    assert(algokit_rbtree_traverse_inorder(tree, collect_keys, &ctx) == 0);
+    assert(ctx.count == CHURN_COUNT);
+    assert(is_sorted(many_ordered, ctx.count));
+
+    printf("rbtree_test: rank and select\n");
+    /* Keys are 0..CHURN_COUNT-1, so key k has rank k. */
+    assert(algokit_rbtree_size(tree) == CHURN_COUNT);
+    for (i = 0; i < CHURN_COUNT; i++) {
+        int key = (int)i;
+        size_t rank;
+        assert(algokit_rbtree_select(tree, i, &item) == 0 && *(int *)item.key == key);
+        assert(algokit_rbtree_rank(tree, &key, &rank) == 0 && rank == i);
+    }
+    assert(algokit_rbtree_select(tree, CHURN_COUNT, &item) == 1);
+    {
+        int lo = -5;
+        int hi = 9;
+        size_t count;
+        assert(algokit_rbtree_count_range(tree, &lo, &hi, &count) == 0 && count == 10);
+        lo = 100;
+        hi = 199;
+        assert(algokit_rbtree_count_range(tree, &lo, &hi, &count) == 0 && count == 100);
+        assert(algokit_rbtree_count_range(tree, &hi, &lo, &count) == 0 && count == 0);
+        hi = CHURN_COUNT + 10;
+        assert(algokit_rbtree_rank(tree, &hi, &count) == 0 && count == CHURN_COUNT);
+        assert(algokit_rbtree_count_range(tree, &lo, NULL, &count) == -1);
+    }
+
+    printf("rbtree_test: rank and select after removals\n");
+    /* Remove the multiples of 3, check ranks against a formula, then put them back. */
+    for (i = 0; i < CHURN_COUNT; i += 3) {
+        int key = (int)i;
+        assert(algokit_rbtree_remove(tree, &key, &item) == 0);
+    }
+    assert(algokit_rbtree_size(tree) == CHURN_COUNT - (CHURN_COUNT + 2) / 3);
+    for (i = 0; i < CHURN_COUNT; i++) {
+        int key = (int)i;
+        size_t rank;
+        /* Keys below i that survive: i minus the multiples of 3 below i. */
+        size_t expected = i - (i + 2) / 3;
+        assert(algokit_rbtree_rank(tree, &key, &rank) == 0 && rank == expected);
+        if (i % 3 != 0) {
+            assert(algokit_rbtree_select(tree, expected, &item) == 0 && *(int *)item.key == key);
+        }
+    }
+    for (i = 0; i < CHURN_COUNT; i++) {
+        if (many[i] % 3 == 0) {
+            item.key = &many[i];
+            item.val = NULL;
+            assert(algokit_rbtree_insert(tree, item) == 0);
+        }
+    }
+    assert(algokit_rbtree_size(tree) == CHURN_COUNT);
+
+    printf("rbtree_test: destroy with callback\n");
+    destroyed = 0;
+    algokit_rbtree_destroy(tree, count_destroy);
+    assert(destroyed == CHURN_COUNT);
     printf("rbtree_test: ok\n");
     return 0;
 }
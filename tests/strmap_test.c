@@ -0,0 +1,92 @@
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "algokit/strmap.h"
+
+#define KEY_COUNT 5000
+
+int main(void) {
+    algokit_strmap *map = algokit_strmap_create(8);
+    static int values[KEY_COUNT];
+    char key[32];
+    char other[32];
+    void *out;
+    size_t arena;
+    int i;
+
+    printf("strmap_test: create\n");
+    assert(map != NULL);
+    assert(algokit_strmap_create(0) == NULL);
+    assert(algokit_strmap_size(map) == 0);
+
+    printf("strmap_test: put and get\n");
+    assert(algokit_strmap_put(map, "apple", 5, &values[0]) == 0);
+    assert(algokit_strmap_put(map, "apple", 5, &values[1]) == 1);
+    assert(algokit_strmap_put(map, "app", 3, &values[1]) == 0);
+    assert(algokit_strmap_put(map, "", 0, &values[2]) == 0);
+    assert(algokit_strmap_put(map, NULL, 0, &values[2]) == 1);
+    assert(algokit_strmap_put(map, NULL, 1, &values[2]) == -1);
+    assert(algokit_strmap_get(map, "apple", 5, &out) == 0 && out == &values[0]);
+    assert(algokit_strmap_get(map, "app", 3, &out) == 0 && out == &values[1]);
+    assert(algokit_strmap_get(map, "", 0, &out) == 0 && out == &values[2]);
+    assert(algokit_strmap_get(map, "appl", 4, &out) == 1);
+    assert(algokit_strmap_get(map, "apples", 6, &out) == 1);
+    assert(algokit_strmap_size(map) == 3);
+    assert(algokit_strmap_arena_bytes(map) == 8);
+
+    printf("strmap_test: keys with NUL bytes\n");
+    /* Same 4-byte prefix and length: only the arena comparison tells them apart. */
+    memcpy(key, "ab\0cdefgh", 9);
+    memcpy(other, "ab\0cdefgX", 9);
+    assert(algokit_strmap_put(map, key, 9, &values[3]) == 0);
+    assert(algokit_strmap_get(map, other, 9, &out) == 1);
+    assert(algokit_strmap_put(map, other, 9, &values[4]) == 0);
+    assert(algokit_strmap_get(map, key, 9, &out) == 0 && out == &values[3]);
+    assert(algokit_strmap_get(map, other, 9, &out) == 0 && out == &values[4]);
+
+    printf("strmap_test: delete\n");
+    assert(algokit_strmap_delete(map, "apple", 5, &out) == 0 && out == &values[0]);
+    assert(algokit_strmap_delete(map, "apple", 5, &out) == 1);
+    assert(algokit_strmap_get(map, "app", 3, &out) == 0);
+    algokit_strmap_destroy(map);
+
+    printf("strmap_test: grow and shrink\n");
+    map = algokit_strmap_create(8);
+    assert(map != NULL);
+    for (i = 0; i < KEY_COUNT; i++) {
+        sprintf(key, "token-%d", i);
+        assert(algokit_strmap_put(map, key, strlen(key), &values[i]) == 0);
+    }
+    for (i = 0; i < KEY_COUNT; i++) {
+        sprintf(key, "token-%d", i);
+        assert(algokit_strmap_get(map, key, strlen(key), &out) == 0 && out == &values[i]);
+    }
+    for (i = 0; i < KEY_COUNT - 10; i++) {
+        sprintf(key, "token-%d", i);
+        assert(algokit_strmap_delete(map, key, strlen(key), &out) == 0 && out == &values[i]);
+    }
+    for (i = 0; i < KEY_COUNT; i++) {
+        sprintf(key, "token-%d", i);
+        assert(algokit_strmap_get(map, key, strlen(key), &out) == (i >= KEY_COUNT - 10 ? 0 : 1));
+    }
+
+    printf("strmap_test: arena compaction\n");
+    /* Churn with fresh keys: dead bytes are reclaimed, so the arena stays bounded. */
+    for (i = 0; i < 100000; i++) {
+        sprintf(key, "churn-%d", i);
+        assert(algokit_strmap_put(map, key, strlen(key), &values[0]) == 0);
+        assert(algokit_strmap_delete(map, key, strlen(key), &out) == 0);
+    }
+    arena = algokit_strmap_arena_bytes(map);
+    assert(arena < 4096);
+    for (i = KEY_COUNT - 10; i < KEY_COUNT; i++) {
+        sprintf(key, "token-%d", i);
+        assert(algokit_strmap_get(map, key, strlen(key), &out) == 0 && out == &values[i]);
+    }
+    assert(algokit_strmap_size(map) == 10);
+    algokit_strmap_destroy(map);
+
+    printf("strmap_test: ok\n");
+    return 0;
+}
@@ -0,0 +1,108 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "algokit/timer_wheel.h"
+
+#define TIMER_COUNT 2000
+
+struct timer_record {
+    uint64_t due;
+    uint64_t fired_at;
+    int fired;
+    int cancelled;
+    algokit_timer_wheel_timer *handle;
+};
+
+struct fire_ctx {
+    algokit_timer_wheel *wheel;
+    size_t fired;
+};
+
+static void on_expire(const Item *item, void *ctx) {
+    struct fire_ctx *c = (struct fire_ctx *)ctx;
+    struct timer_record *rec = (struct timer_record *)item->key;
+
+    assert(!rec->fired);
+    assert(!rec->cancelled);
+    rec->fired = 1;
+    rec->fired_at = algokit_timer_wheel_now(c->wheel);
+    c->fired++;
+}
+
+static void count_destroy(void *key, void *val) {
+    (void)key;
+    (*(int *)val)++;
+}
+
+int main(void) {
+    static struct timer_record records[TIMER_COUNT];
+    algokit_timer_wheel *wheel = algokit_timer_wheel_create(1000);
+    struct fire_ctx ctx;
+    Item item;
+    size_t i;
+    uint64_t delays[] = {1, 2, 63, 64, 65, 4095, 4096, 4097, 262143, 262144, 300000};
+    int destroyed = 0;
+
+    printf("timer_wheel_test: create\n");
+    assert(wheel != NULL);
+    assert(algokit_timer_wheel_now(wheel) == 1000);
+    ctx.wheel = wheel;
+    ctx.fired = 0;
+
+    printf("timer_wheel_test: boundaries\n");
+    for (i = 0; i < sizeof(delays) / sizeof(delays[0]); i++) {
+        records[i].due = 1000 + delays[i];
+        item.key = &records[i];
+        item.val = NULL;
+        assert(algokit_timer_wheel_schedule(wheel, delays[i], item, &records[i].handle) == 0);
+    }
+    assert(algokit_timer_wheel_advance(wheel, 300000, on_expire, &ctx) == sizeof(delays) / sizeof(delays[0]));
+    for (i = 0; i < sizeof(delays) / sizeof(delays[0]); i++) {
+        assert(records[i].fired);
+        assert(records[i].fired_at == records[i].due);
+    }
+    assert(algokit_timer_wheel_size(wheel) == 0);
+
+    printf("timer_wheel_test: churn\n");
+    srand(42);
+    ctx.fired = 0;
+    for (i = 0; i < TIMER_COUNT; i++) {
+        uint64_t delay = 1 + (uint64_t)(rand() % 20000);
+        records[i].due = algokit_timer_wheel_now(wheel) + delay;
+        records[i].fired = 0;
+        records[i].cancelled = 0;
+        item.key = &records[i];
+        item.val = NULL;
+        assert(algokit_timer_wheel_schedule(wheel, delay, item, &records[i].handle) == 0);
+        if (i % 50 == 0) {
+            algokit_timer_wheel_advance(wheel, 7, on_expire, &ctx);
+        }
+    }
+    for (i = 0; i < TIMER_COUNT; i += 3) {
+        if (!records[i].fired) {
+            assert(algokit_timer_wheel_cancel(wheel, records[i].handle, &item) == 0);
+            assert(item.key == &records[i]);
+            records[i].cancelled = 1;
+        }
+    }
+    algokit_timer_wheel_advance(wheel, 30000, on_expire, &ctx);
+    assert(algokit_timer_wheel_size(wheel) == 0);
+    for (i = 0; i < TIMER_COUNT; i++) {
+        assert(records[i].fired != records[i].cancelled);
+        if (records[i].fired) {
+            assert(records[i].fired_at == records[i].due);
+        }
+    }
+
+    printf("timer_wheel_test: destroy\n");
+    item.key = NULL;
+    item.val = &destroyed;
+    assert(algokit_timer_wheel_schedule(wheel, 5, item, NULL) == 0);
+    assert(algokit_timer_wheel_schedule(wheel, 500000, item, NULL) == 0);
+    algokit_timer_wheel_destroy(wheel, count_destroy);
+    assert(destroyed == 2);
+    printf("timer_wheel_test: ok\n");
+    return 0;
+}
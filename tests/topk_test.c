@@ -0,0 +1,83 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "algokit/topk.h"
+
+static int int_key_cmp(const void *a, const void *b) {
+    int va = *(const int *)a;
+    int vb = *(const int *)b;
+    return (va > vb) - (va < vb);
+}
+
+static int dropped_count;
+
+static void count_dropped(void *key, void *val) {
+    (void)key;
+    (void)val;
+    dropped_count++;
+}
+
+int main(void) {
+    algokit_topk *topk = algokit_topk_create(3, int_key_cmp);
+    algokit_topk *other;
+    int values[] = {5, 1, 9, 3, 7, 2, 8};
+    int more[] = {6, 10, 4};
+    Item item;
+    Item out;
+    Item sorted[3];
+    size_t count;
+    size_t i;
+    int rejected = 0;
+
+    printf("topk_test: create\n");
+    assert(topk != NULL);
+    assert(algokit_topk_create(0, int_key_cmp) == NULL);
+    assert(algokit_topk_capacity(topk) == 3);
+
+    printf("topk_test: offer\n");
+    for (i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        item.key = &values[i];
+        item.val = NULL;
+        if (algokit_topk_offer(topk, item, &out) == 1) {
+            rejected++;
+        }
+    }
+    assert(rejected == 4);
+    assert(algokit_topk_size(topk) == 3);
+    assert(algokit_topk_threshold(topk, &out) == 0);
+    assert(*(int *)out.key == 7);
+
+    printf("topk_test: fast reject\n");
+    item.key = &values[1];
+    assert(algokit_topk_offer(topk, item, &out) == 1);
+    assert(out.key == &values[1]);
+
+    printf("topk_test: merge\n");
+    other = algokit_topk_create(3, int_key_cmp);
+    assert(other != NULL);
+    for (i = 0; i < sizeof(more) / sizeof(more[0]); i++) {
+        item.key = &more[i];
+        item.val = NULL;
+        assert(algokit_topk_offer(other, item, &out) == 0);
+    }
+    dropped_count = 0;
+    assert(algokit_topk_merge(topk, other, count_dropped) == 0);
+    assert(dropped_count == 3);
+    assert(algokit_topk_size(other) == 0);
+    assert(algokit_topk_merge(topk, topk, NULL) != 0);
+
+    printf("topk_test: drain\n");
+    assert(algokit_topk_drain_sorted(topk, sorted, &count) == 0);
+    assert(count == 3);
+    assert(*(int *)sorted[0].key == 10);
+    assert(*(int *)sorted[1].key == 9);
+    assert(*(int *)sorted[2].key == 8);
+    assert(algokit_topk_size(topk) == 0);
+
+    printf("topk_test: destroy\n");
+    algokit_topk_destroy(other, NULL);
+    algokit_topk_destroy(topk, NULL);
+    printf("topk_test: ok\n");
+    return 0;
+}